@@ -4,7 +4,7 @@ REM Variables relevant to the compilation of the program.
 
 SET CXX=g++
 
-SET CPPSRCS=src/CoordGeodetic.cpp src/CoordTopocentric.cpp src/DateTime.cpp src/DecayedException.cpp src/Eci.cpp src/Globals.cpp src/Observer.cpp src/OrbitalElements.cpp src/SatelliteException.cpp src/SGP4.cpp src/SolarPosition.cpp src/TimeSpan.cpp src/Tle.cpp src/TleException.cpp src/Util.cpp src/Vector.cpp
+SET CPPSRCS=src/CatalogSnapshot.cpp src/ConjunctionScreener.cpp src/CoordGeodetic.cpp src/CoordinateKernel.cpp src/CoordTopocentric.cpp src/DateTime.cpp src/DecayedException.cpp src/Eci.cpp src/EphemerisInterpolator.cpp src/Globals.cpp src/MappedFile.cpp src/NearSpaceKernel.cpp src/Observer.cpp src/OrbitalElements.cpp src/PassPredictor.cpp src/SatelliteCatalogPropagator.cpp src/SatelliteException.cpp src/SGP4.cpp src/ShellIndex.cpp src/SolarPosition.cpp src/ThreadPool.cpp src/TimeGrid.cpp src/TimeSpan.cpp src/Tle.cpp src/TleCatalog.cpp src/TleException.cpp src/TleParser.cpp src/TleReader.cpp src/Tracker.cpp src/Util.cpp src/Vector.cpp src/VisibilityScheduler.cpp
 
 SET EDCXXFLAGS=-I ./ -I ./include/ -Wall
 
@@ -19,4 +19,28 @@ ECHO Compiling %CPPSRCS% into %TARGET% using %CXX% with %EDCXXFLAGS% flag(s)...
 CMD /c "%CXX% %EDCXXFLAGS% examples/passpredict.cpp %CPPSRCS% -o passpredict.exe %EDLDFLAGS%"
 CMD /c "%CXX% %EDCXXFLAGS% examples/runtest.cpp %CPPSRCS% -o runtest.exe %EDLDFLAGS%"
 CMD /c "%CXX% %EDCXXFLAGS% examples/sattrack.cpp %CPPSRCS% -o sattrack.exe %EDLDFLAGS%"
-CMD /c "%CXX% %EDCXXFLAGS% examples/obtaintle.cpp %CPPSRCS% -o obtaintle.exe %EDLDFLAGS%"
\ No newline at end of file
+CMD /c "%CXX% %EDCXXFLAGS% examples/obtaintle.cpp %CPPSRCS% -o obtaintle.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/batchbench.cpp %CPPSRCS% -o batchbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/catalogbench.cpp %CPPSRCS% -o catalogbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/kerneltest.cpp %CPPSRCS% -o kerneltest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/threadtest.cpp %CPPSRCS% -o threadtest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/resonancebench.cpp %CPPSRCS% -o resonancebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/parallelbench.cpp %CPPSRCS% -o parallelbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/passbench.cpp %CPPSRCS% -o passbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/schedulebench.cpp %CPPSRCS% -o schedulebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/gridbench.cpp %CPPSRCS% -o gridbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/tleparsebench.cpp %CPPSRCS% -o tleparsebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/tleloadbench.cpp %CPPSRCS% -o tleloadbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/tleingestbench.cpp %CPPSRCS% -o tleingestbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/snapshottest.cpp %CPPSRCS% -o snapshottest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/ephemerisbench.cpp %CPPSRCS% -o ephemerisbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/conjunctionbench.cpp %CPPSRCS% -o conjunctionbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/shelltest.cpp %CPPSRCS% -o shelltest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/geodeticbench.cpp %CPPSRCS% -o geodeticbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/lookanglebench.cpp %CPPSRCS% -o lookanglebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/trackbench.cpp %CPPSRCS% -o trackbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/microbench.cpp %CPPSRCS% -o microbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/verifytest.cpp %CPPSRCS% -o verifytest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/modelbench.cpp %CPPSRCS% -o modelbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/statusbench.cpp %CPPSRCS% -o statusbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples/floatbench.cpp %CPPSRCS% -o floatbench.exe %EDLDFLAGS%"
\ No newline at end of file
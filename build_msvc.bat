@@ -4,7 +4,7 @@ REM Variables relevant to the compilation of the program.
 
 SET CXX=cl
 
-SET CPPSRCS=src\CoordGeodetic.cpp src\CoordTopocentric.cpp src\DateTime.cpp src\DecayedException.cpp src\Eci.cpp src\Globals.cpp src\Observer.cpp src\OrbitalElements.cpp src\SatelliteException.cpp src\SGP4.cpp src\SolarPosition.cpp src\TimeSpan.cpp src\Tle.cpp src\TleException.cpp src\Util.cpp src\Vector.cpp
+SET CPPSRCS=src\CatalogSnapshot.cpp src\ConjunctionScreener.cpp src\CoordGeodetic.cpp src\CoordinateKernel.cpp src\CoordTopocentric.cpp src\DateTime.cpp src\DecayedException.cpp src\Eci.cpp src\EphemerisInterpolator.cpp src\Globals.cpp src\MappedFile.cpp src\NearSpaceKernel.cpp src\Observer.cpp src\OrbitalElements.cpp src\PassPredictor.cpp src\SatelliteCatalogPropagator.cpp src\SatelliteException.cpp src\SGP4.cpp src\ShellIndex.cpp src\SolarPosition.cpp src\ThreadPool.cpp src\TimeGrid.cpp src\TimeSpan.cpp src\Tle.cpp src\TleCatalog.cpp src\TleException.cpp src\TleParser.cpp src\TleReader.cpp src\Tracker.cpp src\Util.cpp src\Vector.cpp src\VisibilityScheduler.cpp
 
 SET EDCXXFLAGS= /I .\ /I .\include\ /W0 /EHsc
 
@@ -19,4 +19,28 @@ ECHO Compiling %CPPSRCS% into %TARGET% using %CXX% with %EDCXXFLAGS% flag(s)...
 CMD /c "%CXX% %EDCXXFLAGS% examples\passpredict.cpp %CPPSRCS% /Fe: passpredict.exe %EDLDFLAGS%"
 CMD /c "%CXX% %EDCXXFLAGS% examples\runtest.cpp %CPPSRCS% /Fe: runtest.exe %EDLDFLAGS%"
 CMD /c "%CXX% %EDCXXFLAGS% examples\sattrack.cpp %CPPSRCS% /Fe: sattrack.exe %EDLDFLAGS%"
-CMD /c "%CXX% %EDCXXFLAGS% examples\obtaintle.cpp %CPPSRCS% /Fe: obtaintle.exe %EDLDFLAGS%"
\ No newline at end of file
+CMD /c "%CXX% %EDCXXFLAGS% examples\obtaintle.cpp %CPPSRCS% /Fe: obtaintle.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\batchbench.cpp %CPPSRCS% /Fe: batchbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\catalogbench.cpp %CPPSRCS% /Fe: catalogbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\kerneltest.cpp %CPPSRCS% /Fe: kerneltest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\threadtest.cpp %CPPSRCS% /Fe: threadtest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\resonancebench.cpp %CPPSRCS% /Fe: resonancebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\parallelbench.cpp %CPPSRCS% /Fe: parallelbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\passbench.cpp %CPPSRCS% /Fe: passbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\schedulebench.cpp %CPPSRCS% /Fe: schedulebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\gridbench.cpp %CPPSRCS% /Fe: gridbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\tleparsebench.cpp %CPPSRCS% /Fe: tleparsebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\tleloadbench.cpp %CPPSRCS% /Fe: tleloadbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\tleingestbench.cpp %CPPSRCS% /Fe: tleingestbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\snapshottest.cpp %CPPSRCS% /Fe: snapshottest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\ephemerisbench.cpp %CPPSRCS% /Fe: ephemerisbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\conjunctionbench.cpp %CPPSRCS% /Fe: conjunctionbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\shelltest.cpp %CPPSRCS% /Fe: shelltest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\geodeticbench.cpp %CPPSRCS% /Fe: geodeticbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\lookanglebench.cpp %CPPSRCS% /Fe: lookanglebench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\trackbench.cpp %CPPSRCS% /Fe: trackbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\microbench.cpp %CPPSRCS% /Fe: microbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\verifytest.cpp %CPPSRCS% /Fe: verifytest.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\modelbench.cpp %CPPSRCS% /Fe: modelbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\statusbench.cpp %CPPSRCS% /Fe: statusbench.exe %EDLDFLAGS%"
+CMD /c "%CXX% %EDCXXFLAGS% examples\floatbench.cpp %CPPSRCS% /Fe: floatbench.exe %EDLDFLAGS%"
\ No newline at end of file
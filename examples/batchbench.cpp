@@ -0,0 +1,89 @@
+/**
+ * @file batchbench.cpp
+ * @brief Compares the throughput of SGP4::FindPositions against a loop of
+ * SGP4::FindPosition calls over the same sample times.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SGP4.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+using namespace LSGP4;
+
+static double ElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool RunBenchmark(const char *label, const Tle &tle, size_t n, double step)
+{
+    SGP4 sgp4(tle);
+
+    std::vector<double> tsince(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        tsince[i] = i * step;
+    }
+
+    std::vector<Vector> loop_pos(n);
+    std::vector<Vector> loop_vel(n);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        Eci eci = sgp4.FindPosition(tsince[i]);
+        loop_pos[i] = eci.Position();
+        loop_vel[i] = eci.Velocity();
+    }
+    const double loop_ns = ElapsedNs(start);
+
+    std::vector<Vector> batch_pos(n);
+    std::vector<Vector> batch_vel(n);
+    start = std::chrono::steady_clock::now();
+    sgp4.FindPositions(tsince.data(), n, batch_pos.data(), batch_vel.data());
+    const double batch_ns = ElapsedNs(start);
+
+    bool match = true;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (loop_pos[i].x != batch_pos[i].x || loop_pos[i].y != batch_pos[i].y || loop_pos[i].z != batch_pos[i].z ||
+            loop_vel[i].x != batch_vel[i].x || loop_vel[i].y != batch_vel[i].y || loop_vel[i].z != batch_vel[i].z)
+        {
+            match = false;
+            break;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::left << std::setw(12) << label
+              << " loop: " << std::setw(8) << loop_ns / n << " ns/op"
+              << "  batch: " << std::setw(8) << batch_ns / n << " ns/op"
+              << "  speedup: " << std::setprecision(2) << loop_ns / batch_ns << "x"
+              << (match ? "" : "  MISMATCH") << std::endl;
+
+    return match;
+}
+
+int main()
+{
+    const size_t n = 200000;
+
+    Tle iss("ISS (ZARYA)",
+            "1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+            "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838");
+    Tle geo("GEO",
+            "1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+            "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981");
+
+    bool ok = RunBenchmark("near-space", iss, n, 1.0 / 60.0);
+    ok = RunBenchmark("deep-space", geo, n, 1.0 / 60.0) && ok;
+
+    return ok ? 0 : 1;
+}
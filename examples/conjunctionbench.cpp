@@ -0,0 +1,405 @@
+/**
+ * @file conjunctionbench.cpp
+ * @brief Screens a crowded synthetic catalog for close approaches with a
+ * ConjunctionScreener, checking the result against an exhaustive search of
+ * every pair, checks that a pair failing to propagate during the search is
+ * skipped where it fails, checks that a screening of deep-space objects a
+ * month after epoch costs no more than one at epoch, then reports the time a
+ * full size catalog screening takes.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <ConjunctionScreener.hpp>
+#include <SatelliteCatalogPropagator.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace LSGP4;
+
+static const double kThreshold = 10.0;
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * random orbits, most in one LEO shell so approaches are common, the rest
+ * in MEO and GEO
+ */
+static std::vector<SGP4> MakeCatalog(size_t count, double low, double high, unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::vector<SGP4> catalog;
+    for (size_t i = 0; i < count; i++)
+    {
+        double mean_motion = low + (high - low) * unit(generator);
+        double eccentricity = 0.0005 + 0.01 * unit(generator);
+        if (i % 50 == 49)
+        {
+            mean_motion = 2.0056 + 0.001 * unit(generator);
+        }
+        else if (i % 100 == 99)
+        {
+            mean_motion = 1.0027 + 0.0002 * unit(generator);
+            eccentricity = 0.0003;
+        }
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05uU 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+                 static_cast<unsigned int>(i % 99999) + 1);
+        snprintf(l2, sizeof(l2), "2 %05u %8.4f %8.4f %07d %8.4f %8.4f %11.8f100000",
+                 static_cast<unsigned int>(i % 99999) + 1,
+                 180.0 * unit(generator), 360.0 * unit(generator),
+                 static_cast<int>(eccentricity * 1.0e7),
+                 360.0 * unit(generator), 360.0 * unit(generator), mean_motion);
+        catalog.push_back(SGP4(Tle(l1, l2)));
+    }
+    return catalog;
+}
+
+struct Approach
+{
+    size_t a;
+    size_t b;
+    double seconds;
+};
+
+/*
+ * every pair sampled every few seconds, each local minimum of the range
+ * refined by golden section search
+ */
+static std::vector<Approach> Exhaustive(const std::vector<SGP4> &catalog, const DateTime &start, double span)
+{
+    const double step = 10.0;
+    const size_t samples = static_cast<size_t>(span / step) + 1;
+    const size_t n = catalog.size();
+
+    SatelliteCatalogPropagator propagator(catalog);
+    std::vector<Vector> positions(n * samples);
+    std::vector<Vector> velocities(n);
+    std::vector<Vector> at_time(n);
+    for (size_t k = 0; k < samples; k++)
+    {
+        propagator.FindPositions(start.AddSeconds(step * k), at_time.data(), velocities.data());
+        for (size_t i = 0; i < n; i++)
+        {
+            positions[i * samples + k] = at_time[i];
+        }
+    }
+
+    std::vector<Approach> approaches;
+    std::vector<double> ranges(samples);
+    for (size_t a = 0; a < n; a++)
+    {
+        for (size_t b = a + 1; b < n; b++)
+        {
+            const Vector *pa = &positions[a * samples];
+            const Vector *pb = &positions[b * samples];
+            for (size_t k = 0; k < samples; k++)
+            {
+                const double dx = pb[k].x - pa[k].x;
+                const double dy = pb[k].y - pa[k].y;
+                const double dz = pb[k].z - pa[k].z;
+                ranges[k] = dx * dx + dy * dy + dz * dz;
+            }
+            for (size_t k = 1; k + 1 < samples; k++)
+            {
+                if (ranges[k] > 300.0 * 300.0 || ranges[k] > ranges[k - 1] || ranges[k] > ranges[k + 1])
+                {
+                    continue;
+                }
+
+                double lo = step * (k - 1);
+                double hi = step * (k + 1);
+                const double ratio = 0.5 * (sqrt(5.0) - 1.0);
+                while (hi - lo > 1.0e-4)
+                {
+                    const double t1 = hi - ratio * (hi - lo);
+                    const double t2 = lo + ratio * (hi - lo);
+                    const double d1 = (catalog[b].FindPosition(start.AddSeconds(t1)).Position() -
+                                       catalog[a].FindPosition(start.AddSeconds(t1)).Position()).Magnitude();
+                    const double d2 = (catalog[b].FindPosition(start.AddSeconds(t2)).Position() -
+                                       catalog[a].FindPosition(start.AddSeconds(t2)).Position()).Magnitude();
+                    if (d1 < d2)
+                    {
+                        hi = t2;
+                    }
+                    else
+                    {
+                        lo = t1;
+                    }
+                }
+                const double t = 0.5 * (lo + hi);
+                const double miss = (catalog[b].FindPosition(start.AddSeconds(t)).Position() -
+                                     catalog[a].FindPosition(start.AddSeconds(t)).Position()).Magnitude();
+                if (miss <= kThreshold)
+                {
+                    Approach approach = {a, b, t};
+                    approaches.push_back(approach);
+                }
+            }
+        }
+    }
+    return approaches;
+}
+
+int main()
+{
+    size_t failures = 0;
+
+    /*
+     * a small crowded catalog, screened and searched exhaustively over four
+     * hours
+     */
+    {
+        const std::vector<SGP4> catalog = MakeCatalog(1000, 15.05, 15.10, 1);
+        const DateTime start = catalog[0].GetTle().Epoch();
+        const double span = 4.0 * 3600.0;
+        const DateTime end = start.AddSeconds(span);
+
+        std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+        const std::vector<Approach> expected = Exhaustive(catalog, start, span);
+        const double exhaustive_ms = ElapsedMs(timer);
+
+        ConjunctionScreener screener(catalog, kThreshold);
+        timer = std::chrono::steady_clock::now();
+        const std::vector<Conjunction> found = screener.FindConjunctions(start, end);
+        const double screen_ms = ElapsedMs(timer);
+
+        ThreadPool pool;
+        const std::vector<Conjunction> pooled = screener.FindConjunctions(start, end, pool);
+
+        /*
+         * approaches within a sample of either end are left out, as the
+         * exhaustive search cannot see their minimum
+         */
+        size_t missed = 0;
+        size_t compared = 0;
+        double worst_tca = 0.0;
+        for (size_t e = 0; e < expected.size(); e++)
+        {
+            if (expected[e].seconds < 10.0 || expected[e].seconds > span - 10.0)
+            {
+                continue;
+            }
+            compared++;
+            bool matched = false;
+            for (size_t f = 0; f < found.size(); f++)
+            {
+                const double dt = fabs((found[f].tca - start).TotalSeconds() - expected[e].seconds);
+                if (found[f].primary == expected[e].a && found[f].secondary == expected[e].b && dt < 0.1)
+                {
+                    worst_tca = std::max(worst_tca, dt);
+                    matched = true;
+                }
+            }
+            if (!matched)
+            {
+                missed++;
+            }
+        }
+
+        size_t extra = 0;
+        for (size_t f = 0; f < found.size(); f++)
+        {
+            const double seconds = (found[f].tca - start).TotalSeconds();
+            if (seconds < 10.0 || seconds > span - 10.0)
+            {
+                continue;
+            }
+            bool matched = false;
+            for (size_t e = 0; e < expected.size() && !matched; e++)
+            {
+                const double dt = fabs((found[f].tca - start).TotalSeconds() - expected[e].seconds);
+                matched = found[f].primary == expected[e].a && found[f].secondary == expected[e].b && dt < 0.1;
+            }
+            if (!matched)
+            {
+                extra++;
+            }
+        }
+
+        size_t pool_mismatches = pooled.size() == found.size() ? 0 : 1;
+        for (size_t f = 0; f < found.size() && f < pooled.size(); f++)
+        {
+            if (pooled[f].primary != found[f].primary || pooled[f].secondary != found[f].secondary ||
+                pooled[f].tca != found[f].tca || pooled[f].miss_distance != found[f].miss_distance)
+            {
+                pool_mismatches++;
+            }
+        }
+
+        failures += missed + extra + pool_mismatches;
+
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << catalog.size() << " objects, 4 h, " << kThreshold << " km" << std::endl;
+        std::cout << "exhaustive: " << exhaustive_ms << " ms, " << compared << " approaches" << std::endl;
+        std::cout << "screener:   " << screen_ms << " ms, " << found.size() << " approaches" << std::endl;
+        std::cout << "missed: " << missed << ", extra: " << extra
+                  << ", pool mismatches: " << pool_mismatches
+                  << ", worst tca difference: " << std::setprecision(4) << worst_tca << " s" << std::endl;
+        std::cout << std::setprecision(1);
+        for (size_t f = 0; f < found.size() && f < 5; f++)
+        {
+            std::cout << "  " << found[f].primary << " - " << found[f].secondary << " at " << found[f].tca
+                      << ", " << std::setprecision(3) << found[f].miss_distance << " km, "
+                      << found[f].relative_speed << " km/s" << std::setprecision(1) << std::endl;
+        }
+    }
+
+    /*
+     * two objects with so much drag they fail to propagate within an hour
+     * of epoch, crossing each other's orbits, screened over two hours
+     */
+    {
+        const Tle decaying("1 28872U 05037B   05333.02012661  .25992681  00000-0  24476-3 0  1534",
+                           "2 28872  96.4736 157.9986 0303955 244.0492 110.6523 16.46015938 10708");
+        std::vector<SGP4> catalog;
+        catalog.push_back(SGP4(decaying));
+        catalog.push_back(SGP4(Tle("1 28873U 05037B   05333.02012661  .25992681  00000-0  24476-3 0  1534",
+                                   "2 28873  96.4736 158.0486 0303955 244.0492 110.6523 16.46015938 10708")));
+        const double span = 2.0 * 3600.0;
+
+        /*
+         * whether both propagate at a time
+         */
+        struct Propagates
+        {
+            static bool Pair(const std::vector<SGP4> &pair, double minutes)
+            {
+                for (size_t i = 0; i < pair.size(); i++)
+                {
+                    SGP4::IntegratorParams state;
+                    Vector position;
+                    Vector velocity;
+                    if (pair[i].FindPosition(minutes, state, position, velocity) != SGP4::OK)
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
+        double failed_seconds = 0.0;
+        while (failed_seconds < span && Propagates::Pair(catalog, failed_seconds / 60.0))
+        {
+            failed_seconds += 1.0;
+        }
+
+        ConjunctionScreener screener(catalog, kThreshold);
+        ThreadPool pool;
+        size_t decay_failures = failed_seconds < span ? 0 : 1;
+        std::vector<Conjunction> found;
+        try
+        {
+            found = screener.FindConjunctions(decaying.Epoch(), decaying.Epoch().AddSeconds(span));
+            if (screener.FindConjunctions(decaying.Epoch(), decaying.Epoch().AddSeconds(span), pool).size() != found.size())
+            {
+                decay_failures++;
+            }
+        }
+        catch (std::exception &)
+        {
+            decay_failures++;
+        }
+        for (size_t f = 0; f < found.size(); f++)
+        {
+            if (!Propagates::Pair(catalog, (found[f].tca - decaying.Epoch()).TotalMinutes()))
+            {
+                decay_failures++;
+            }
+        }
+        if (found.empty())
+        {
+            decay_failures++;
+        }
+
+        failures += decay_failures;
+
+        std::cout << "decaying pair: " << found.size() << " approaches, first failure to propagate at "
+                  << std::setprecision(0) << failed_seconds / 60.0 << " min, failures: " << decay_failures
+                  << std::setprecision(1) << std::endl;
+    }
+
+    /*
+     * a crowded geosynchronous shell, whose resonant orbits are integrated
+     * from epoch unless checkpoints are used, screened over six hours at
+     * epoch and a month later for approaches within 200 km, so that many are
+     * refined. the caller's models have checkpoints disabled, which the
+     * screener's own copies must not inherit
+     */
+    {
+        std::vector<SGP4> catalog = MakeCatalog(300, 1.0026, 1.0028, 4);
+        for (size_t i = 0; i < catalog.size(); i++)
+        {
+            catalog[i].SetIntegratorCheckpoints(false);
+        }
+        const DateTime epoch = catalog[0].GetTle().Epoch();
+        const ConjunctionScreener screener(catalog, 200.0);
+
+        double elapsed_ms[2];
+        size_t found[2];
+        for (int d = 0; d < 2; d++)
+        {
+            const DateTime start = epoch.AddDays(d == 0 ? 0.0 : 30.0);
+            const std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+            found[d] = screener.FindConjunctions(start, start.AddHours(6.0)).size();
+            elapsed_ms[d] = ElapsedMs(timer);
+        }
+
+        /*
+         * a loose bound, as integrating from epoch for every propagation
+         * costs several times more a month out
+         */
+        const size_t late_failures = elapsed_ms[1] < 3.0 * elapsed_ms[0] ? 0 : 1;
+        failures += late_failures;
+
+        std::cout << catalog.size() << " geosynchronous, 6 h: at epoch " << elapsed_ms[0] << " ms, "
+                  << found[0] << " approaches, at +30 d " << elapsed_ms[1] << " ms, "
+                  << found[1] << " approaches, failures: " << late_failures << std::endl;
+    }
+
+    /*
+     * a fleet against a full size catalog, and the catalog against itself,
+     * over an hour
+     */
+    {
+        const std::vector<SGP4> catalog = MakeCatalog(25000, 11.0, 16.0, 2);
+        const std::vector<SGP4> fleet = MakeCatalog(500, 14.5, 15.5, 3);
+        const DateTime start = catalog[0].GetTle().Epoch();
+        const DateTime end = start.AddHours(1.0);
+
+        ConjunctionScreener fleet_screener(fleet, catalog, 5.0);
+        std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+        const size_t fleet_found = fleet_screener.FindConjunctions(start, end).size();
+        const double fleet_ms = ElapsedMs(timer);
+
+        ConjunctionScreener catalog_screener(catalog, 5.0);
+        timer = std::chrono::steady_clock::now();
+        const size_t catalog_found = catalog_screener.FindConjunctions(start, end).size();
+        const double catalog_ms = ElapsedMs(timer);
+
+        std::cout << "500 x 25000, 1 h:   " << fleet_ms << " ms, " << fleet_found << " approaches" << std::endl;
+        std::cout << "25000 x 25000, 1 h: " << catalog_ms << " ms, " << catalog_found << " approaches" << std::endl;
+    }
+
+    std::cout << "failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
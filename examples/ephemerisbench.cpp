@@ -0,0 +1,182 @@
+/**
+ * @file ephemerisbench.cpp
+ * @brief Fits an EphemerisInterpolator to LEO, GPS, Molniya and GEO orbits
+ * over a day from epoch, and Molniya and GEO over a day from 90 days after
+ * epoch, with each method, checking the interpolated positions and
+ * velocities are within the tolerances of SGP4 at random times, and
+ * reporting the build time, the size of the fit and the cost of a query
+ * against a direct SGP4 evaluation.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <EphemerisInterpolator.hpp>
+#include <SGP4.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kQueries = 200000;
+static const double kTolerance = 1.0e-3;
+static const double kVelocityTolerance = 1.0e-4;
+
+/*
+ * orbits, and the days after epoch their span starts. the resonant orbits
+ * are also fitted far from epoch, where each sample continues the
+ * integrator from the last rather than from epoch
+ */
+static const struct
+{
+    const char *name;
+    const char *line1;
+    const char *line2;
+    double days;
+} kOrbits[] = {
+    {"LEO",
+     "1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838",
+     0.0},
+    {"GPS",
+     "1 28129U 03058A   06175.57071136 -.00000104  00000-0  10000-3 0   459",
+     "2 28129  54.7298 324.8098 0048506 266.2640  93.1663  2.00562768 18443",
+     0.0},
+    {"Molniya",
+     "1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656",
+     0.0},
+    {"GEO",
+     "1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+     "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981",
+     0.0},
+    {"Molniya",
+     "1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656",
+     90.0},
+    {"GEO",
+     "1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+     "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981",
+     90.0}};
+
+static double ElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    size_t failures = 0;
+
+    std::cout << std::left << std::setw(9) << "orbit" << std::setw(7) << "day" << std::setw(11) << "method"
+              << std::right << std::setw(10) << "build ms" << std::setw(10) << "segments"
+              << std::setw(8) << "evals" << std::setw(11) << "query ns" << std::setw(10) << "sgp4 ns"
+              << std::setw(12) << "max err m" << std::setw(14) << "max err mm/s" << std::endl;
+
+    for (size_t s = 0; s < sizeof(kOrbits) / sizeof(kOrbits[0]); s++)
+    {
+        const SGP4 sgp4(Tle(kOrbits[s].name, kOrbits[s].line1, kOrbits[s].line2));
+        const DateTime start = sgp4.GetTle().Epoch().AddDays(kOrbits[s].days);
+        const DateTime end = start.AddDays(1.0);
+        const double first = (start - sgp4.GetTle().Epoch()).TotalMinutes();
+        const double last = (end - sgp4.GetTle().Epoch()).TotalMinutes();
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> distribution(first, last);
+        std::vector<double> times(kQueries);
+        for (size_t i = 0; i < kQueries; i++)
+        {
+            times[i] = distribution(generator);
+        }
+
+        /*
+         * a direct SGP4 evaluation, for the cost a query replaces
+         */
+        std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+        double sink = 0.0;
+        for (size_t i = 0; i < kQueries / 10; i++)
+        {
+            sink += sgp4.FindPosition(times[i]).Position().x;
+        }
+        const double sgp4_ns = ElapsedNs(timer) / (kQueries / 10);
+
+        for (int m = 0; m < 2; m++)
+        {
+            const EphemerisInterpolator::Method method =
+                m == 0 ? EphemerisInterpolator::HERMITE : EphemerisInterpolator::CHEBYSHEV;
+
+            timer = std::chrono::steady_clock::now();
+            const EphemerisInterpolator ephemeris(sgp4, start, end, kTolerance, method, kVelocityTolerance);
+            const double build_ms = ElapsedNs(timer) / 1.0e6;
+
+            Vector position;
+            Vector velocity;
+            timer = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < kQueries; i++)
+            {
+                ephemeris.FindPosition(times[i], position, velocity);
+                sink += position.x;
+            }
+            const double query_ns = ElapsedNs(timer) / kQueries;
+
+            double max_position = 0.0;
+            double max_velocity = 0.0;
+            for (size_t i = 0; i < kQueries; i++)
+            {
+                const Eci eci = sgp4.FindPosition(times[i]);
+                ephemeris.FindPosition(times[i], position, velocity);
+                max_position = std::max(max_position, (position - eci.Position()).Magnitude());
+                max_velocity = std::max(max_velocity, (velocity - eci.Velocity()).Magnitude());
+            }
+
+            if (max_position > kTolerance || max_velocity > kVelocityTolerance)
+            {
+                failures++;
+            }
+
+            std::cout << std::left << std::setw(9) << kOrbits[s].name
+                      << std::setw(7) << std::setprecision(0) << std::fixed << kOrbits[s].days
+                      << std::setw(11) << (m == 0 ? "hermite" : "chebyshev") << std::right
+                      << std::fixed << std::setprecision(2) << std::setw(10) << build_ms
+                      << std::setw(10) << ephemeris.SegmentCount()
+                      << std::setw(8) << ephemeris.EvaluationCount()
+                      << std::setprecision(1) << std::setw(11) << query_ns
+                      << std::setw(10) << sgp4_ns
+                      << std::setprecision(3) << std::setw(12) << max_position * 1000.0
+                      << std::setw(14) << max_velocity * 1.0e6 << std::endl;
+        }
+
+        /*
+         * the span is enforced
+         */
+        const EphemerisInterpolator ephemeris(sgp4, start, end);
+        try
+        {
+            ephemeris.FindPosition(end.AddMinutes(1.0));
+            failures++;
+        }
+        catch (std::out_of_range &)
+        {
+        }
+        if (ephemeris.Start() != start || ephemeris.End() != end)
+        {
+            failures++;
+        }
+
+        if (sink == 0.0)
+        {
+            failures++;
+        }
+    }
+
+    std::cout << "failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file floatbench.cpp
+ * @brief Propagates a synthetic catalog of near-space objects one to seven
+ * days from epoch with NearSpaceKernel in double and single precision,
+ * reporting how the single precision error grows with the time since epoch
+ * and the time taken by each implementation.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SatelliteCatalogPropagator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * base orbits the catalog is generated from: ISS, sun-synchronous LEO, low
+ * perigee LEO (simple model), LEO and an eccentric orbit
+ */
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 28057U 03049A   06177.78615833  .00000060  00000-0  35940-4 0  1836",
+     "2 28057  98.4283 247.6961 0000884  88.1964 271.9322 14.35478080140550"},
+    {"1 29238U 06022G   06177.28732010  .00766286  10823-4  13334-2 0   101",
+     "2 29238  51.5595 213.7903 0202579  95.2503 267.9010 15.73823839  1061"},
+    {"1 06251U 62025E   06176.82412014  .00008885  00000-0  12808-3 0  3985",
+     "2 06251  58.0579  54.0425 0030035 139.1568 221.1854 15.56387291  6774"},
+    {"1 00005U 58002B   00179.78495062  .00000023  00000-0  28098-4 0  4753",
+     "2 00005  34.2682 348.7242 1859667 331.7664  19.3264 10.82419157413667"}};
+
+static const size_t kObjects = 20000;
+static const int kDays = 7;
+static const size_t kRepetitions = 5;
+
+static std::vector<SGP4> GenerateCatalog(size_t n)
+{
+    std::vector<SGP4> models;
+    models.reserve(n);
+
+    const size_t nbase = sizeof(kBaseTles) / sizeof(kBaseTles[0]);
+    for (size_t i = 0; i < n; i++)
+    {
+        const size_t base = i % nbase;
+        const unsigned int norad = static_cast<unsigned int>(i % 99999) + 1;
+        const double raan = static_cast<double>((i * 37) % 3600) / 10.0;
+        const double anomaly = static_cast<double>((i * 101) % 3600) / 10.0;
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05u%s", norad, kBaseTles[base][0] + 7);
+        snprintf(l2, sizeof(l2), "2 %05u %.8s %8.4f %.17s%8.4f%s",
+                 norad, kBaseTles[base][1] + 8, raan, kBaseTles[base][1] + 26, anomaly, kBaseTles[base][1] + 51);
+
+        models.push_back(SGP4(Tle(l1, l2)));
+    }
+
+    return models;
+}
+
+static double Distance(const Vector &a, const Vector &b)
+{
+    const double dx = a.x - b.x;
+    const double dy = a.y - b.y;
+    const double dz = a.z - b.z;
+    return sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+/*
+ * best time per object of several runs, in nanoseconds
+ */
+template <typename Function>
+static double TimeNs(size_t n, Function run)
+{
+    double best = 1.0e30;
+    for (size_t r = 0; r < kRepetitions; r++)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        run();
+        best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best / static_cast<double>(n);
+}
+
+int main()
+{
+    const std::vector<SGP4> models = GenerateCatalog(kObjects);
+    const size_t n = models.size();
+
+    std::vector<double> consts(NearSpaceKernel::FIELD_COUNT * n);
+    for (size_t i = 0; i < n; i++)
+    {
+        NearSpaceKernel::Pack(models[i], consts.data(), n, i);
+    }
+
+    std::vector<double> tsince(n);
+    std::vector<Vector> ref_pos(n);
+    std::vector<Vector> ref_vel(n);
+    std::vector<unsigned char> ref_status(n);
+    std::vector<Vector> pos(n);
+    std::vector<Vector> vel(n);
+    std::vector<unsigned char> status(n);
+
+    const NearSpaceKernel::Isa best = NearSpaceKernel::BestIsa();
+    size_t failures = 0;
+
+    /*
+     * errors against the exact scalar model, at each day from epoch
+     */
+    std::cout << "single precision " << NearSpaceKernel::IsaName(best) << " against the scalar double model, "
+              << n << " objects" << std::endl;
+    std::cout << std::setw(4) << "day" << std::setw(10) << "samples" << std::setw(14) << "median pos m"
+              << std::setw(13) << "p99 pos m" << std::setw(13) << "max pos m" << std::setw(15) << "max vel mm/s"
+              << std::setw(10) << "status" << std::endl;
+
+    for (int day = 1; day <= kDays; day++)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            tsince[i] = 1440.0 * day + static_cast<double>((i * 7) % 1440);
+        }
+
+        NearSpaceKernel::Propagate(NearSpaceKernel::SCALAR, consts.data(), n, tsince.data(), n, NULL,
+                                   ref_pos.data(), ref_vel.data(), ref_status.data());
+        NearSpaceKernel::PropagateFloat(best, consts.data(), n, tsince.data(), n, NULL,
+                                        pos.data(), vel.data(), status.data());
+
+        std::vector<double> position_errors;
+        double max_velocity = 0.0;
+        size_t status_mismatches = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (status[i] != ref_status[i])
+            {
+                status_mismatches++;
+            }
+            else if (status[i] == SGP4::OK)
+            {
+                position_errors.push_back(Distance(pos[i], ref_pos[i]) * 1000.0);
+                max_velocity = std::max(max_velocity, Distance(vel[i], ref_vel[i]) * 1.0e6);
+            }
+        }
+        std::sort(position_errors.begin(), position_errors.end());
+
+        /*
+         * the float model decays at a slightly different time from the
+         * double one, so only a few objects may disagree
+         */
+        if (status_mismatches > n / 1000 || position_errors.empty())
+        {
+            failures++;
+            continue;
+        }
+
+        const size_t count = position_errors.size();
+        std::cout << std::setw(4) << day << std::setw(10) << count << std::fixed << std::setprecision(2)
+                  << std::setw(14) << position_errors[count / 2]
+                  << std::setw(13) << position_errors[count * 99 / 100]
+                  << std::setw(13) << position_errors[count - 1]
+                  << std::setw(15) << max_velocity
+                  << std::setw(10) << status_mismatches << std::endl;
+    }
+
+    /*
+     * the opt-in of the catalog propagator, at the last day
+     */
+    SatelliteCatalogPropagator catalog(models);
+    catalog.SetSinglePrecision(true);
+    std::vector<Vector> catalog_pos(n);
+    std::vector<Vector> catalog_vel(n);
+    std::unique_ptr<bool[]> valid(new bool[n]);
+    catalog.FindPositions(tsince.data(), catalog_pos.data(), catalog_vel.data(), valid.get());
+    NearSpaceKernel::PropagateFloat(catalog.KernelIsa(), consts.data(), n, tsince.data(), n, NULL,
+                                    pos.data(), vel.data(), status.data());
+    for (size_t i = 0; i < n; i++)
+    {
+        if (Distance(catalog_pos[i], pos[i]) != 0.0 || Distance(catalog_vel[i], vel[i]) != 0.0 ||
+            valid[i] != (status[i] == SGP4::OK))
+        {
+            failures++;
+            break;
+        }
+    }
+
+    /*
+     * throughput at the last day
+     */
+    std::cout << std::endl
+              << std::setw(8) << "isa" << std::setw(12) << "double ns" << std::setw(12) << "float ns"
+              << std::setw(10) << "speedup" << std::endl;
+    const NearSpaceKernel::Isa isas[] = {NearSpaceKernel::SCALAR, NearSpaceKernel::SSE2,
+                                         NearSpaceKernel::AVX2, NearSpaceKernel::AVX512};
+    for (size_t k = 0; k < sizeof(isas) / sizeof(isas[0]); k++)
+    {
+        if (!NearSpaceKernel::IsSupported(isas[k]))
+        {
+            continue;
+        }
+
+        const NearSpaceKernel::Isa isa = isas[k];
+        const double double_ns = TimeNs(n, [&]()
+        {
+            NearSpaceKernel::Propagate(isa, consts.data(), n, tsince.data(), n, NULL,
+                                       ref_pos.data(), ref_vel.data(), ref_status.data());
+        });
+        const double float_ns = TimeNs(n, [&]()
+        {
+            NearSpaceKernel::PropagateFloat(isa, consts.data(), n, tsince.data(), n, NULL,
+                                            pos.data(), vel.data(), status.data());
+        });
+
+        std::cout << std::setw(8) << NearSpaceKernel::IsaName(isa) << std::fixed << std::setprecision(1)
+                  << std::setw(12) << double_ns << std::setw(12) << float_ns
+                  << std::setw(10) << std::setprecision(2) << double_ns / float_ns << std::endl;
+    }
+
+    std::cout << "failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file geodeticbench.cpp
+ * @brief Converts positions from the surface out to beyond geostationary
+ * altitude to geodetic coordinates with CoordinateKernel::ToGeodetic() on
+ * every supported instruction set, checking them against
+ * Eci::ToGeodetic() and a round trip back to Eci, and reporting the cost of
+ * a conversion against the iterative one.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <CoordinateKernel.hpp>
+#include <Eci.hpp>
+#include <Globals.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kTimes = 100;
+static const size_t kPointsPerTime = 10000;
+
+/*
+ * tolerances against Eci::ToGeodetic(), which stops iterating at 1e-10
+ * radians, and for the round trip, in kilometers
+ */
+static const double kTolerance = 1.0e-5;
+static const double kRoundTripTolerance = 1.0e-6;
+
+static double ElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double AngleDifference(double a, double b)
+{
+    double d = fmod(fabs(a - b), kTWOPI);
+    return d > kPI ? kTWOPI - d : d;
+}
+
+int main()
+{
+    const size_t n = kTimes * kPointsPerTime;
+
+    /*
+     * random directions, with radii from just below the surface out to
+     * twice geostationary, the poles and the equator included
+     */
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const DateTime start(2026, 10, 16, 0, 0, 0);
+
+    std::vector<Eci> eci;
+    eci.reserve(n);
+    for (size_t t = 0; t < kTimes; t++)
+    {
+        const DateTime dt = start.AddMinutes(static_cast<double>(t) * 14.4);
+        for (size_t i = 0; i < kPointsPerTime; i++)
+        {
+            const double radius = kXKMPER - 30.0 + 84000.0 * pow(unit(generator), 3.0);
+            double sin_lat = 2.0 * unit(generator) - 1.0;
+            if (i % 100 == 0)
+            {
+                sin_lat = (i % 200 == 0) ? 1.0 : 0.0;
+            }
+            const double cos_lat = sqrt(1.0 - sin_lat * sin_lat);
+            const double lon = kTWOPI * unit(generator);
+            eci.push_back(Eci(dt, Vector(radius * cos_lat * cos(lon), radius * cos_lat * sin(lon), radius * sin_lat)));
+        }
+    }
+
+    std::vector<CoordGeodetic> reference(n);
+    std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        reference[i] = eci[i].ToGeodetic();
+    }
+    const double iterative_ns = ElapsedNs(timer) / n;
+
+    std::vector<CoordGeodetic> batch(n);
+    timer = std::chrono::steady_clock::now();
+    Eci::ToGeodetic(eci.data(), n, batch.data());
+    const double batch_ns = ElapsedNs(timer) / n;
+
+    /*
+     * the kernel on its own, from arrays of coordinates at each time
+     */
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    std::vector<double> z(n);
+    std::vector<double> gmst(kTimes);
+    for (size_t i = 0; i < n; i++)
+    {
+        const Vector position = eci[i].Position();
+        x[i] = position.x;
+        y[i] = position.y;
+        z[i] = position.z;
+    }
+    for (size_t t = 0; t < kTimes; t++)
+    {
+        gmst[t] = eci[t * kPointsPerTime].GetDateTime().ToGreenwichSiderealTime();
+    }
+
+    size_t failures = 0;
+
+    std::cout << std::left << std::setw(12) << "method"
+              << std::right << std::setw(14) << "max dlat m" << std::setw(14) << "max dlon m"
+              << std::setw(14) << "max dalt m" << std::setw(16) << "round trip m"
+              << std::setw(12) << "ns/point" << std::setw(10) << "speedup" << std::endl;
+
+    /*
+     * the iterative conversion's own round trip, for comparison, away from
+     * the poles
+     */
+    double reference_trip = 0.0;
+    for (size_t i = 0; i < n; i += 7)
+    {
+        if (cos(reference[i].latitude) <= 1.0e-3)
+        {
+            continue;
+        }
+        const Vector back = Eci(eci[i].GetDateTime(), reference[i]).Position();
+        const Vector position = eci[i].Position();
+        const double d = sqrt((back.x - position.x) * (back.x - position.x) +
+                              (back.y - position.y) * (back.y - position.y) +
+                              (back.z - position.z) * (back.z - position.z));
+        reference_trip = d > reference_trip ? d : reference_trip;
+    }
+    std::cout << std::left << std::setw(12) << "iterative" << std::right << std::scientific << std::setprecision(2)
+              << std::setw(14) << 0.0 << std::setw(14) << 0.0 << std::setw(14) << 0.0
+              << std::setw(16) << reference_trip * 1000.0
+              << std::fixed << std::setprecision(1) << std::setw(12) << iterative_ns
+              << std::setw(10) << 1.0 << std::endl;
+
+    const NearSpaceKernel::Isa isas[] = {NearSpaceKernel::SCALAR,
+                                         NearSpaceKernel::SSE2,
+                                         NearSpaceKernel::AVX2,
+                                         NearSpaceKernel::AVX512};
+
+    std::vector<double> lat(n);
+    std::vector<double> lon(n);
+    std::vector<double> alt(n);
+    for (size_t k = 0; k <= sizeof(isas) / sizeof(isas[0]); k++)
+    {
+        const bool is_batch = k == sizeof(isas) / sizeof(isas[0]);
+        double ns = batch_ns;
+        if (is_batch)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                lat[i] = batch[i].latitude;
+                lon[i] = batch[i].longitude;
+                alt[i] = batch[i].altitude;
+            }
+        }
+        else
+        {
+            if (!NearSpaceKernel::IsSupported(isas[k]))
+            {
+                continue;
+            }
+            timer = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < kTimes; t++)
+            {
+                const size_t first = t * kPointsPerTime;
+                CoordinateKernel::ToGeodetic(isas[k], gmst[t], &x[first], &y[first], &z[first], kPointsPerTime,
+                                             &lat[first], &lon[first], &alt[first]);
+            }
+            ns = ElapsedNs(timer) / n;
+        }
+
+        double max_lat = 0.0;
+        double max_lon = 0.0;
+        double max_alt = 0.0;
+        double max_trip = 0.0;
+        for (size_t i = 0; i < n; i++)
+        {
+            /*
+             * angles as distances along the surface, longitude along the
+             * parallel, which vanishes at the poles
+             */
+            const double dlat = fabs(lat[i] - reference[i].latitude) * kXKMPER;
+            const double dlon = AngleDifference(lon[i], reference[i].longitude) * kXKMPER * cos(reference[i].latitude);
+            /*
+             * Eci::ToGeodetic() divides by the cosine of the latitude for the
+             * altitude, which loses it close to the poles
+             */
+            const double dalt = cos(reference[i].latitude) > 1.0e-3 ? fabs(alt[i] - reference[i].altitude) : 0.0;
+            max_lat = dlat > max_lat ? dlat : max_lat;
+            max_lon = dlon > max_lon ? dlon : max_lon;
+            max_alt = dalt > max_alt ? dalt : max_alt;
+
+            if (i % 7 == 0)
+            {
+                const Vector back = Eci(eci[i].GetDateTime(), CoordGeodetic(lat[i], lon[i], alt[i], true)).Position();
+                const Vector position = eci[i].Position();
+                const double d = sqrt((back.x - position.x) * (back.x - position.x) +
+                                      (back.y - position.y) * (back.y - position.y) +
+                                      (back.z - position.z) * (back.z - position.z));
+                max_trip = d > max_trip ? d : max_trip;
+            }
+        }
+
+        const bool ok = max_lat <= kTolerance && max_lon <= kTolerance && max_alt <= kTolerance &&
+                        max_trip <= kRoundTripTolerance;
+        if (!ok)
+        {
+            failures++;
+        }
+
+        std::cout << std::left << std::setw(12) << (is_batch ? "Eci batch" : NearSpaceKernel::IsaName(isas[k]))
+                  << std::right << std::scientific << std::setprecision(2)
+                  << std::setw(14) << max_lat * 1000.0 << std::setw(14) << max_lon * 1000.0
+                  << std::setw(14) << max_alt * 1000.0 << std::setw(16) << max_trip * 1000.0
+                  << std::fixed << std::setprecision(1) << std::setw(12) << ns
+                  << std::setw(10) << std::setprecision(2) << iterative_ns / ns
+                  << (ok ? "" : "  FAILED") << std::endl;
+    }
+
+    std::cout << "failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file gridbench.cpp
+ * @brief Computes the look angles from a network of ground stations to a
+ * constellation over a day with a TimeGrid and with Observer::GetLookAngle,
+ * checking the two agree exactly and reporting the time taken by each.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Observer.hpp>
+#include <SGP4.hpp>
+#include <TimeGrid.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kSatellites = 200;
+static const size_t kStations = 20;
+static const size_t kSteps = 720;
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    std::vector<SGP4> satellites;
+    for (size_t i = 0; i < kSatellites; i++)
+    {
+        const double raan = static_cast<double>((i * 37) % 3600) / 10.0;
+        const double anomaly = static_cast<double>((i * 101) % 3600) / 10.0;
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05uU 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+                 static_cast<unsigned int>(i + 1));
+        snprintf(l2, sizeof(l2), "2 %05u  51.6389 %8.4f 0004535 264.0051 %8.4f 15.48792552314838",
+                 static_cast<unsigned int>(i + 1), raan, anomaly);
+        satellites.push_back(SGP4(Tle(l1, l2)));
+    }
+
+    std::vector<Observer> stations;
+    for (size_t k = 0; k < kStations; k++)
+    {
+        stations.push_back(Observer(-60.0 + 120.0 * k / kStations, -180.0 + 360.0 * k / kStations, 0.1));
+    }
+
+    /*
+     * one day at two minute steps
+     */
+    const DateTime start = satellites[0].GetTle().Epoch();
+    const TimeSpan step(0, 2, 0);
+
+    std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+    TimeGrid grid(start, step, kSteps);
+    for (size_t k = 0; k < kStations; k++)
+    {
+        grid.AddObserver(stations[k].GetLocation());
+    }
+    const double setup_ms = ElapsedMs(timer);
+
+    /*
+     * propagate up front so only the look angles are timed
+     */
+    std::vector<Eci> eci;
+    for (size_t i = 0; i < kSteps; i++)
+    {
+        for (size_t s = 0; s < kSatellites; s++)
+        {
+            eci.push_back(satellites[s].FindPosition(grid.Time(i)));
+        }
+    }
+
+    const size_t count = kSteps * kSatellites * kStations;
+    std::vector<CoordTopocentric> reference(count);
+    std::vector<CoordTopocentric> look_angles(count);
+
+    /*
+     * time outermost, as when propagating a catalog step by step
+     */
+    timer = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kSteps; i++)
+    {
+        for (size_t k = 0; k < kStations; k++)
+        {
+            for (size_t s = 0; s < kSatellites; s++)
+            {
+                reference[(i * kStations + k) * kSatellites + s] = stations[k].GetLookAngle(eci[i * kSatellites + s]);
+            }
+        }
+    }
+    const double observer_ms = ElapsedMs(timer);
+
+    timer = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kSteps; i++)
+    {
+        for (size_t k = 0; k < kStations; k++)
+        {
+            grid.GetLookAngles(k, i, &eci[i * kSatellites], kSatellites, &look_angles[(i * kStations + k) * kSatellites]);
+        }
+    }
+    const double grid_ms = ElapsedMs(timer);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (reference[i].azimuth != look_angles[i].azimuth ||
+            reference[i].elevation != look_angles[i].elevation ||
+            reference[i].range != look_angles[i].range ||
+            reference[i].range_rate != look_angles[i].range_rate)
+        {
+            mismatches++;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << kSatellites << " satellites x " << kStations << " stations x " << kSteps << " steps" << std::endl;
+    std::cout << "grid set up: " << setup_ms << " ms" << std::endl;
+    std::cout << "observer:    " << observer_ms << " ms (" << observer_ms * 1.0e6 / count << " ns/look angle)" << std::endl;
+    std::cout << "grid:        " << grid_ms << " ms (" << grid_ms * 1.0e6 / count << " ns/look angle, "
+              << observer_ms / grid_ms << "x)" << std::endl;
+    std::cout << "mismatches:  " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,257 @@
+/**
+ * @file kerneltest.cpp
+ * @brief Validates every NearSpaceKernel implementation the CPU supports
+ * against SGP4::FindPosition on the runtest cases in SGP4-VER.TLE, and
+ * reports the near-space throughput of each.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SatelliteCatalogPropagator.hpp>
+#include <Util.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * largest differences accepted from the scalar model
+ */
+static const double kPositionTolerance = 1.0e-6;
+static const double kVelocityTolerance = 1.0e-9;
+
+/*
+ * one propagation of one test case
+ */
+struct Sample
+{
+    Tle tle;
+    double tsince;
+};
+
+/*
+ * the test cases and sample times runtest uses
+ */
+static bool ReadSamples(const char *infile, std::vector<Sample> &samples)
+{
+    std::ifstream file(infile);
+    if (!file.is_open())
+    {
+        std::cerr << "Error opening file" << std::endl;
+        return false;
+    }
+
+    bool got_first_line = false;
+    std::string line1;
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        Util::Trim(line);
+
+        if (line.length() == 0 || line[0] == '#')
+        {
+            got_first_line = false;
+            continue;
+        }
+
+        if (!got_first_line)
+        {
+            if (line.length() >= Tle::LineLength())
+            {
+                got_first_line = true;
+                line1 = line;
+            }
+            continue;
+        }
+
+        got_first_line = false;
+        if (line.length() < Tle::LineLength())
+        {
+            continue;
+        }
+
+        double start = 0.0;
+        double end = 1440.0;
+        double inc = 120.0;
+        if (line.length() > Tle::LineLength())
+        {
+            std::istringstream parameters(line.substr(Tle::LineLength()));
+            double s;
+            double e;
+            double i;
+            if (parameters >> s >> e >> i)
+            {
+                start = s;
+                end = e;
+                inc = i;
+            }
+        }
+
+        try
+        {
+            Sample sample = {Tle("Test", line1, line.substr(0, Tle::LineLength())), 0.0};
+            samples.push_back(sample);
+            for (double t = start; t < end; t += inc)
+            {
+                sample.tsince = t;
+                samples.push_back(sample);
+            }
+            sample.tsince = end;
+            samples.push_back(sample);
+        }
+        catch (TleException &e)
+        {
+            std::cerr << "Error: " << e.what() << std::endl;
+        }
+    }
+
+    return true;
+}
+
+static double ElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    const char *file_name = argc > 1 ? argv[1] : "SGP4-VER.TLE";
+
+    std::vector<Sample> samples;
+    if (!ReadSamples(file_name, samples) || samples.empty())
+    {
+        return 1;
+    }
+
+    const size_t n = samples.size();
+    std::vector<Tle> tles;
+    std::vector<double> tsince(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        tles.push_back(samples[i].tle);
+        tsince[i] = samples[i].tsince;
+    }
+
+    /*
+     * reference results, one model per sample
+     */
+    std::vector<Vector> ref_pos(n);
+    std::vector<Vector> ref_vel(n);
+    std::vector<bool> ref_valid(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        try
+        {
+            SGP4 sgp4(tles[i]);
+            Eci eci = sgp4.FindPosition(tsince[i]);
+            ref_pos[i] = eci.Position();
+            ref_vel[i] = eci.Velocity();
+            ref_valid[i] = true;
+        }
+        catch (DecayedException &e)
+        {
+            ref_pos[i] = e.Position();
+            ref_vel[i] = e.Velocity();
+            ref_valid[i] = false;
+        }
+        catch (SatelliteException &)
+        {
+            ref_valid[i] = false;
+        }
+    }
+
+    SatelliteCatalogPropagator catalog(tles);
+    std::cout << n << " samples, " << catalog.NearSpaceCount() << " near-space, best kernel "
+              << NearSpaceKernel::IsaName(NearSpaceKernel::BestIsa()) << std::endl;
+
+    /*
+     * a larger set of the near-space samples for timing
+     */
+    const size_t repeats = 64;
+    std::vector<Tle> timing_tles;
+    std::vector<double> timing_tsince;
+    for (size_t r = 0; r < repeats; r++)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            if (OrbitalElements(tles[i]).Period() < 225.0)
+            {
+                timing_tles.push_back(tles[i]);
+                timing_tsince.push_back(tsince[i]);
+            }
+        }
+    }
+    SatelliteCatalogPropagator timing_catalog(timing_tles);
+    std::vector<Vector> timing_pos(timing_tles.size());
+    std::vector<Vector> timing_vel(timing_tles.size());
+
+    bool ok = true;
+    double scalar_ns = 0.0;
+    const NearSpaceKernel::Isa isas[] = {NearSpaceKernel::SCALAR,
+                                         NearSpaceKernel::SSE2,
+                                         NearSpaceKernel::AVX2,
+                                         NearSpaceKernel::AVX512};
+
+    for (size_t k = 0; k < sizeof(isas) / sizeof(isas[0]); k++)
+    {
+        if (!NearSpaceKernel::IsSupported(isas[k]))
+        {
+            continue;
+        }
+
+        catalog.SetKernelIsa(isas[k]);
+        std::vector<Vector> pos(n);
+        std::vector<Vector> vel(n);
+        bool *valid = new bool[n];
+        catalog.FindPositions(tsince.data(), pos.data(), vel.data(), valid);
+
+        size_t mismatches = 0;
+        double max_pos = 0.0;
+        double max_vel = 0.0;
+        for (size_t i = 0; i < n; i++)
+        {
+            const double dpos = (pos[i] - ref_pos[i]).Magnitude();
+            const double dvel = (vel[i] - ref_vel[i]).Magnitude();
+            max_pos = dpos > max_pos ? dpos : max_pos;
+            max_vel = dvel > max_vel ? dvel : max_vel;
+
+            if (valid[i] != ref_valid[i] || !(dpos <= kPositionTolerance) || !(dvel <= kVelocityTolerance))
+            {
+                mismatches++;
+            }
+        }
+        delete[] valid;
+
+        timing_catalog.SetKernelIsa(isas[k]);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        timing_catalog.FindPositions(timing_tsince.data(), timing_pos.data(), timing_vel.data());
+        const double ns = ElapsedNs(start) / timing_tles.size();
+        if (isas[k] == NearSpaceKernel::SCALAR)
+        {
+            scalar_ns = ns;
+        }
+
+        std::cout << std::left << std::setw(8) << NearSpaceKernel::IsaName(isas[k])
+                  << std::scientific << std::setprecision(2)
+                  << " max position error: " << max_pos << " km"
+                  << "  max velocity error: " << max_vel << " km/s"
+                  << std::fixed << std::setprecision(1)
+                  << "  " << ns << " ns/sample (" << std::setprecision(2) << scalar_ns / ns << "x)"
+                  << (mismatches ? "  FAILED" : "") << std::endl;
+
+        ok = ok && mismatches == 0;
+    }
+
+    return ok ? 0 : 1;
+}
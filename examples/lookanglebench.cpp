@@ -0,0 +1,270 @@
+/**
+ * @file lookanglebench.cpp
+ * @brief Computes the look angles from one observer to a synthetic catalog
+ * with CoordinateKernel::GetLookAngles() on every supported instruction set,
+ * checking them against Observer::GetLookAngle() and reporting the cost of a
+ * look angle and of a sweep of the whole catalog, as for an all-sky update
+ * once a second.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <CoordTopocentric.hpp>
+#include <CoordinateKernel.hpp>
+#include <Globals.hpp>
+#include <Observer.hpp>
+#include <SatelliteCatalogPropagator.hpp>
+#include <TimeGrid.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kCatalogSize = 25000;
+static const size_t kRepeats = 20;
+
+/*
+ * angles in radians, range in kilometers and range rate in kilometers per
+ * second
+ */
+static const double kAngleTolerance = 1.0e-12;
+static const double kRangeTolerance = 1.0e-9;
+
+static double ElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * mostly LEO, with MEO and GEO
+ */
+static std::vector<Tle> MakeCatalog()
+{
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::vector<Tle> catalog;
+    for (size_t i = 0; i < kCatalogSize; i++)
+    {
+        double mean_motion = 13.0 + 3.0 * unit(generator);
+        if (i % 10 == 0)
+        {
+            mean_motion = 2.0 + 0.01 * unit(generator);
+        }
+        else if (i % 10 == 1)
+        {
+            mean_motion = 1.0027 + 0.001 * unit(generator);
+        }
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05uU 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+                 static_cast<unsigned int>(i % 99999) + 1);
+        snprintf(l2, sizeof(l2), "2 %05u %8.4f %8.4f %07d %8.4f %8.4f %11.8f100000",
+                 static_cast<unsigned int>(i % 99999) + 1,
+                 180.0 * unit(generator), 360.0 * unit(generator),
+                 static_cast<int>(0.01 * unit(generator) * 1.0e7),
+                 360.0 * unit(generator), 360.0 * unit(generator), mean_motion);
+        catalog.push_back(Tle(l1, l2));
+    }
+    return catalog;
+}
+
+static double AngleDifference(double a, double b)
+{
+    double d = fmod(fabs(a - b), kTWOPI);
+    return d > kPI ? kTWOPI - d : d;
+}
+
+int main()
+{
+    const SatelliteCatalogPropagator propagator(MakeCatalog());
+    const size_t n = propagator.Size();
+    const DateTime dt(2021, 12, 4, 12, 0, 0);
+
+    std::vector<Vector> positions(n);
+    std::vector<Vector> velocities(n);
+    propagator.FindPositions(dt, positions.data(), velocities.data());
+
+    std::vector<Eci> eci;
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    std::vector<double> z(n);
+    std::vector<double> vx(n);
+    std::vector<double> vy(n);
+    std::vector<double> vz(n);
+    eci.reserve(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        eci.push_back(Eci(dt, positions[i], velocities[i]));
+        x[i] = positions[i].x;
+        y[i] = positions[i].y;
+        z[i] = positions[i].z;
+        vx[i] = velocities[i].x;
+        vy[i] = velocities[i].y;
+        vz[i] = velocities[i].z;
+    }
+
+    const CoordGeodetic site(51.5074, -0.1278, 0.05);
+    Observer observer(site);
+
+    /*
+     * one look angle at a time
+     */
+    std::vector<CoordTopocentric> reference(n);
+    std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < kRepeats; r++)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            reference[i] = observer.GetLookAngle(eci[i]);
+        }
+    }
+    const double observer_ns = ElapsedNs(timer) / (n * kRepeats);
+
+    const std::vector<DateTime> times(1, dt);
+    TimeGrid grid(times);
+    const size_t grid_observer = grid.AddObserver(site);
+    std::vector<CoordTopocentric> grid_angles(n);
+    timer = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < kRepeats; r++)
+    {
+        grid.GetLookAngles(grid_observer, 0, eci.data(), n, grid_angles.data());
+    }
+    const double grid_ns = ElapsedNs(timer) / (n * kRepeats);
+
+    /*
+     * the station as Observer::GetLookAngles() builds it
+     */
+    const double theta = dt.ToLocalMeanSiderealTime(site.longitude);
+    const Eci site_eci(dt, site);
+    CoordinateKernel::Station station;
+    station.position[0] = site_eci.Position().x;
+    station.position[1] = site_eci.Position().y;
+    station.position[2] = site_eci.Position().z;
+    station.velocity[0] = site_eci.Velocity().x;
+    station.velocity[1] = site_eci.Velocity().y;
+    station.velocity[2] = site_eci.Velocity().z;
+    station.sin_lat = sin(site.latitude);
+    station.cos_lat = cos(site.latitude);
+    station.sin_theta = sin(theta);
+    station.cos_theta = cos(theta);
+
+    std::cout << std::left << std::setw(16) << "method"
+              << std::right << std::setw(12) << "max daz" << std::setw(12) << "max del"
+              << std::setw(12) << "max drange" << std::setw(12) << "max drate"
+              << std::setw(11) << "ns/angle" << std::setw(10) << "speedup"
+              << std::setw(13) << "ms/sweep" << std::endl;
+
+    std::cout << std::left << std::setw(16) << "Observer" << std::right << std::scientific << std::setprecision(2)
+              << std::setw(12) << 0.0 << std::setw(12) << 0.0 << std::setw(12) << 0.0 << std::setw(12) << 0.0
+              << std::fixed << std::setprecision(1) << std::setw(11) << observer_ns
+              << std::setw(10) << std::setprecision(2) << 1.0
+              << std::setw(13) << std::setprecision(3) << observer_ns * n * 1.0e-6 << std::endl;
+    std::cout << std::left << std::setw(16) << "TimeGrid" << std::right << std::scientific << std::setprecision(2)
+              << std::setw(12) << 0.0 << std::setw(12) << 0.0 << std::setw(12) << 0.0 << std::setw(12) << 0.0
+              << std::fixed << std::setprecision(1) << std::setw(11) << grid_ns
+              << std::setw(10) << std::setprecision(2) << observer_ns / grid_ns
+              << std::setw(13) << std::setprecision(3) << grid_ns * n * 1.0e-6 << std::endl;
+
+    const NearSpaceKernel::Isa isas[] = {NearSpaceKernel::SCALAR,
+                                         NearSpaceKernel::SSE2,
+                                         NearSpaceKernel::AVX2,
+                                         NearSpaceKernel::AVX512};
+    const size_t methods = sizeof(isas) / sizeof(isas[0]) + 2;
+
+    size_t failures = 0;
+    std::vector<double> az(n);
+    std::vector<double> el(n);
+    std::vector<double> range(n);
+    std::vector<double> rate(n);
+    for (size_t k = 0; k < methods; k++)
+    {
+        const char *name = "";
+        timer = std::chrono::steady_clock::now();
+        if (k < sizeof(isas) / sizeof(isas[0]))
+        {
+            if (!NearSpaceKernel::IsSupported(isas[k]))
+            {
+                continue;
+            }
+            name = NearSpaceKernel::IsaName(isas[k]);
+            for (size_t r = 0; r < kRepeats; r++)
+            {
+                CoordinateKernel::GetLookAngles(isas[k], station, x.data(), y.data(), z.data(),
+                                                vx.data(), vy.data(), vz.data(), n,
+                                                az.data(), el.data(), range.data(), rate.data());
+            }
+        }
+        else if (k == methods - 2)
+        {
+            name = "Observer batch";
+            for (size_t r = 0; r < kRepeats; r++)
+            {
+                observer.GetLookAngles(dt, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data(), n,
+                                       az.data(), el.data(), range.data(), rate.data());
+            }
+        }
+        else
+        {
+            name = "TimeGrid batch";
+            for (size_t r = 0; r < kRepeats; r++)
+            {
+                grid.GetLookAngles(grid_observer, 0, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data(), n,
+                                   az.data(), el.data(), range.data(), rate.data());
+            }
+        }
+        const double ns = ElapsedNs(timer) / (n * kRepeats);
+
+        /*
+         * azimuth as an angle on the sky, which vanishes at the zenith
+         */
+        double max_az = 0.0;
+        double max_el = 0.0;
+        double max_range = 0.0;
+        double max_rate = 0.0;
+        for (size_t i = 0; i < n; i++)
+        {
+            const double daz = AngleDifference(az[i], reference[i].azimuth) * cos(reference[i].elevation);
+            const double del = fabs(el[i] - reference[i].elevation);
+            const double drange = fabs(range[i] - reference[i].range);
+            const double drate = fabs(rate[i] - reference[i].range_rate);
+            max_az = daz > max_az ? daz : max_az;
+            max_el = del > max_el ? del : max_el;
+            max_range = drange > max_range ? drange : max_range;
+            max_rate = drate > max_rate ? drate : max_rate;
+            if (!(az[i] >= 0.0 && az[i] < kTWOPI))
+            {
+                failures++;
+            }
+        }
+
+        const bool ok = max_az <= kAngleTolerance && max_el <= kAngleTolerance &&
+                        max_range <= kRangeTolerance && max_rate <= kRangeTolerance;
+        if (!ok)
+        {
+            failures++;
+        }
+
+        std::cout << std::left << std::setw(16) << name << std::right << std::scientific << std::setprecision(2)
+                  << std::setw(12) << max_az << std::setw(12) << max_el
+                  << std::setw(12) << max_range << std::setw(12) << max_rate
+                  << std::fixed << std::setprecision(1) << std::setw(11) << ns
+                  << std::setw(10) << std::setprecision(2) << observer_ns / ns
+                  << std::setw(13) << std::setprecision(3) << ns * n * 1.0e-6
+                  << (ok ? "" : "  FAILED") << std::endl;
+    }
+
+    std::cout << n << " objects, failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,372 @@
+/**
+ * @file microbench.cpp
+ * @brief Microbenchmarks of the hot paths of the library, run by the bench
+ * target of the Makefile. Each benchmark's iteration count is grown until a
+ * run takes at least the minimum time, the run is repeated, and the median
+ * and best time per operation are reported as CSV, or as JSON with --json,
+ * for tracking regressions.
+ *
+ * Options: --json, --filter=<substring of the name>, --min-time=<seconds>,
+ * --repetitions=<count>
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <CoordTopocentric.hpp>
+#include <Observer.hpp>
+#include <SGP4.hpp>
+#include <SolarPosition.hpp>
+#include <Tracker.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace LSGP4;
+
+static const char *kNearName = "ISS (ZARYA)";
+static const char *kNearLine1 = "1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996";
+static const char *kNearLine2 = "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838";
+static const char *kDeepName = "GPS BIIR-10";
+static const char *kDeepLine1 = "1 28129U 03058A   06175.57071136 -.00000104  00000-0  10000-3 0   459";
+static const char *kDeepLine2 = "2 28129  54.7298 324.8098 0048506 266.2640  93.1663  2.00562768 18443";
+
+/*
+ * inputs cycle through this many distinct times, so that nothing is cached
+ * from one operation to the next
+ */
+static const size_t kInputs = 1024;
+
+/*
+ * results are accumulated here so that the work cannot be optimised away
+ */
+static volatile double g_sink = 0.0;
+
+namespace
+{
+    struct Inputs
+    {
+        Inputs()
+            : near(Tle(kNearName, kNearLine1, kNearLine2)),
+              deep(Tle(kDeepName, kDeepLine1, kDeepLine2)),
+              observer(51.5074, -0.1278, 0.05)
+        {
+            const DateTime start(2021, 12, 4, 0, 0, 0);
+            for (size_t i = 0; i < kInputs; i++)
+            {
+                tsince.push_back(720.0 + 1.37 * static_cast<double>(i));
+                dates.push_back(start.AddSeconds(7.3 * static_cast<double>(i)));
+                eci.push_back(near.FindPosition(dates.back()));
+            }
+
+            /*
+             * the same positions at one time, as a catalog snapshot
+             */
+            for (size_t i = 0; i < kInputs; i++)
+            {
+                snapshot.push_back(Eci(dates[0], eci[i].Position(), eci[i].Velocity()));
+            }
+        }
+
+        SGP4 near;
+        SGP4 deep;
+        Observer observer;
+        SolarPosition sun;
+        std::vector<double> tsince;
+        std::vector<DateTime> dates;
+        std::vector<Eci> eci;
+        std::vector<Eci> snapshot;
+    };
+
+    Inputs *g_inputs = NULL;
+
+    void TleConstruction(size_t iterations)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            const Tle tle(kNearName, kNearLine1, kNearLine2);
+            sum += tle.MeanMotion();
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void Sgp4ConstructionNear(size_t iterations)
+    {
+        const Tle tle(kNearName, kNearLine1, kNearLine2);
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            const SGP4 sgp4(tle);
+            sum += sgp4.GetOrbitalElements().RecoveredSemiMajorAxis();
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void Sgp4ConstructionDeep(size_t iterations)
+    {
+        const Tle tle(kDeepName, kDeepLine1, kDeepLine2);
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            const SGP4 sgp4(tle);
+            sum += sgp4.GetOrbitalElements().RecoveredSemiMajorAxis();
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void FindPositionTsince(const SGP4 &sgp4, size_t iterations)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            sum += sgp4.FindPosition(g_inputs->tsince[i % kInputs]).Position().x;
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void FindPositionDate(const SGP4 &sgp4, size_t iterations)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            sum += sgp4.FindPosition(g_inputs->dates[i % kInputs]).Position().x;
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void FindPositionTsinceNear(size_t iterations)
+    {
+        FindPositionTsince(g_inputs->near, iterations);
+    }
+
+    void FindPositionTsinceDeep(size_t iterations)
+    {
+        FindPositionTsince(g_inputs->deep, iterations);
+    }
+
+    void FindPositionDateNear(size_t iterations)
+    {
+        FindPositionDate(g_inputs->near, iterations);
+    }
+
+    void FindPositionDateDeep(size_t iterations)
+    {
+        FindPositionDate(g_inputs->deep, iterations);
+    }
+
+    void EciToGeodetic(size_t iterations)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            sum += g_inputs->eci[i % kInputs].ToGeodetic().latitude;
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void EciToGeodeticBatch(size_t iterations)
+    {
+        std::vector<CoordGeodetic> geodetic(kInputs);
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i += kInputs)
+        {
+            const size_t n = std::min(kInputs, iterations - i);
+            Eci::ToGeodetic(&g_inputs->snapshot[0], n, &geodetic[0]);
+            sum += geodetic[0].latitude;
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void ObserverGetLookAngle(size_t iterations)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            sum += g_inputs->observer.GetLookAngle(g_inputs->eci[i % kInputs]).elevation;
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void TrackerTick(size_t iterations)
+    {
+        Tracker tracker(g_inputs->near, CoordGeodetic(51.5074, -0.1278, 0.05),
+                        g_inputs->dates[0], TimeSpan(0, 0, 0, 0, 100000));
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            tracker.Tick();
+            sum += tracker.LookAngle().elevation;
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void SolarPositionFindPosition(size_t iterations)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            sum += g_inputs->sun.FindPosition(g_inputs->dates[i % kInputs]).Position().x;
+        }
+        g_sink = g_sink + sum;
+    }
+
+    void DateTimeGreenwichSiderealTime(size_t iterations)
+    {
+        double sum = 0.0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            sum += g_inputs->dates[i % kInputs].ToGreenwichSiderealTime();
+        }
+        g_sink = g_sink + sum;
+    }
+
+    struct Benchmark
+    {
+        const char *name;
+        void (*run)(size_t iterations);
+    };
+
+    const Benchmark kBenchmarks[] = {
+        {"Tle/construct", TleConstruction},
+        {"SGP4/construct/near", Sgp4ConstructionNear},
+        {"SGP4/construct/deep", Sgp4ConstructionDeep},
+        {"SGP4/FindPosition/tsince/near", FindPositionTsinceNear},
+        {"SGP4/FindPosition/tsince/deep", FindPositionTsinceDeep},
+        {"SGP4/FindPosition/DateTime/near", FindPositionDateNear},
+        {"SGP4/FindPosition/DateTime/deep", FindPositionDateDeep},
+        {"Eci/ToGeodetic", EciToGeodetic},
+        {"Eci/ToGeodetic/batch", EciToGeodeticBatch},
+        {"Observer/GetLookAngle", ObserverGetLookAngle},
+        {"Tracker/Tick", TrackerTick},
+        {"SolarPosition/FindPosition", SolarPositionFindPosition},
+        {"DateTime/ToGreenwichSiderealTime", DateTimeGreenwichSiderealTime}};
+
+    double RunNs(const Benchmark &benchmark, size_t iterations)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        benchmark.run(iterations);
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    struct Result
+    {
+        const char *name;
+        size_t iterations;
+        double median_ns;
+        double best_ns;
+    };
+
+    Result Measure(const Benchmark &benchmark, double min_time, size_t repetitions)
+    {
+        /*
+         * grow the iteration count until a run takes the minimum time
+         */
+        const double target_ns = min_time * 1.0e9;
+        size_t iterations = 1;
+        double ns = RunNs(benchmark, iterations);
+        while (ns < target_ns)
+        {
+            double scale = ns > 0.0 ? 1.4 * target_ns / ns : 100.0;
+            scale = std::max(2.0, std::min(100.0, scale));
+            iterations = static_cast<size_t>(static_cast<double>(iterations) * scale);
+            ns = RunNs(benchmark, iterations);
+        }
+
+        std::vector<double> per_op(1, ns / static_cast<double>(iterations));
+        for (size_t r = 1; r < repetitions; r++)
+        {
+            per_op.push_back(RunNs(benchmark, iterations) / static_cast<double>(iterations));
+        }
+        std::sort(per_op.begin(), per_op.end());
+
+        Result result;
+        result.name = benchmark.name;
+        result.iterations = iterations;
+        result.median_ns = per_op[per_op.size() / 2];
+        result.best_ns = per_op[0];
+        return result;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bool json = false;
+    std::string filter;
+    double min_time = 0.2;
+    size_t repetitions = 5;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0)
+        {
+            json = true;
+        }
+        else if (strncmp(argv[i], "--filter=", 9) == 0)
+        {
+            filter = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--min-time=", 11) == 0)
+        {
+            min_time = atof(argv[i] + 11);
+        }
+        else if (strncmp(argv[i], "--repetitions=", 14) == 0)
+        {
+            repetitions = std::max(1, atoi(argv[i] + 14));
+        }
+        else
+        {
+            std::cerr << "usage: " << argv[0]
+                      << " [--json] [--filter=<substring>] [--min-time=<seconds>] [--repetitions=<count>]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    Inputs inputs;
+    g_inputs = &inputs;
+
+    std::vector<Result> results;
+    for (size_t b = 0; b < sizeof(kBenchmarks) / sizeof(kBenchmarks[0]); b++)
+    {
+        if (filter.empty() || std::string(kBenchmarks[b].name).find(filter) != std::string::npos)
+        {
+            results.push_back(Measure(kBenchmarks[b], min_time, repetitions));
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    if (json)
+    {
+        std::cout << "{\n  \"repetitions\": " << repetitions << ",\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            std::cout << (i == 0 ? "\n" : ",\n")
+                      << "    {\"name\": \"" << results[i].name << "\""
+                      << ", \"iterations\": " << results[i].iterations
+                      << ", \"ns_per_op\": " << results[i].median_ns
+                      << ", \"ops_per_s\": " << 1.0e9 / results[i].median_ns
+                      << ", \"best_ns_per_op\": " << results[i].best_ns << "}";
+        }
+        std::cout << "\n  ]\n}" << std::endl;
+    }
+    else
+    {
+        std::cout << "name,iterations,ns_per_op,ops_per_s,best_ns_per_op" << std::endl;
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            std::cout << results[i].name << "," << results[i].iterations << "," << results[i].median_ns << ","
+                      << 1.0e9 / results[i].median_ns << "," << results[i].best_ns << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file modelbench.cpp
+ * @brief Propagates a synthetic mixed catalog of near-space, simple
+ * near-space and deep-space objects in shuffled order, one object at a time
+ * with the model tested at run time, and grouped by model with the variants
+ * of SGP4::FindPosition() that fix the model at compile time, checking the
+ * results are identical and reporting the time taken by each.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SGP4.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * base orbits the catalog is generated from: regular LEO, low perigee LEO
+ * (simple model), GPS and GEO (deep space)
+ */
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 28057U 03049A   06177.78615833  .00000060  00000-0  35940-4 0  1836",
+     "2 28057  98.4283 247.6961 0000884  88.1964 271.9322 14.35478080140550"},
+    {"1 29238U 06022G   06177.28732010  .00766286  10823-4  13334-2 0   101",
+     "2 29238  51.5595 213.7903 0202579  95.2503 267.9010 15.73823839  1061"},
+    {"1 28129U 03058A   06175.57071136 -.00000104  00000-0  10000-3 0   459",
+     "2 28129  54.7298 324.8098 0048506 266.2640  93.1663  2.00562768 18443"},
+    {"1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+     "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981"}};
+
+static const size_t kObjects = 20000;
+static const size_t kTimes = 8;
+static const size_t kRepetitions = 5;
+
+static std::vector<SGP4> GenerateCatalog(size_t n)
+{
+    std::vector<SGP4> models;
+    models.reserve(n);
+
+    const size_t nbase = sizeof(kBaseTles) / sizeof(kBaseTles[0]);
+    for (size_t i = 0; i < n; i++)
+    {
+        /*
+         * interleave the base orbits so the model changes from one object
+         * to the next, as in a catalog sorted by number
+         */
+        const size_t base = (i * 7919) % nbase;
+        const unsigned int norad = static_cast<unsigned int>(i % 99999) + 1;
+        const double raan = static_cast<double>((i * 37) % 3600) / 10.0;
+        const double anomaly = static_cast<double>((i * 101) % 3600) / 10.0;
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05u%s", norad, kBaseTles[base][0] + 7);
+        snprintf(l2, sizeof(l2), "2 %05u %.8s %8.4f %.17s%8.4f%s",
+                 norad, kBaseTles[base][1] + 8, raan, kBaseTles[base][1] + 26, anomaly, kBaseTles[base][1] + 51);
+
+        models.push_back(SGP4(Tle(l1, l2)));
+    }
+
+    /*
+     * a fixed shuffle, so no model runs in long stretches
+     */
+    for (size_t i = n; i > 1; i--)
+    {
+        std::swap(models[i - 1], models[(i * 2654435761u) % i]);
+    }
+
+    return models;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * the objects of one model, copied together and in the order of their
+ * outputs, as a catalog engine would keep them
+ */
+struct Group
+{
+    std::vector<SGP4> models;
+    std::vector<size_t> index;
+};
+
+template <bool DeepSpace, bool SimpleModel>
+static void PropagateGroup(const Group &group,
+                           double tsince,
+                           Vector *positions,
+                           Vector *velocities)
+{
+    for (size_t k = 0; k < group.models.size(); k++)
+    {
+        const size_t i = group.index[k];
+        SGP4::IntegratorParams state;
+        group.models[k].FindPosition<DeepSpace, SimpleModel>(tsince, state, positions[i], velocities[i]);
+    }
+}
+
+int main()
+{
+    const std::vector<SGP4> models = GenerateCatalog(kObjects);
+
+    Group near;
+    Group simple;
+    Group deep;
+    for (size_t i = 0; i < models.size(); i++)
+    {
+        Group &group = models[i].UseDeepSpace() ? deep : models[i].UseSimpleModel() ? simple : near;
+        group.models.push_back(models[i]);
+        group.index.push_back(i);
+    }
+
+    std::cout << "catalog: " << models.size() << " objects, " << near.models.size() << " near-space, "
+              << simple.models.size() << " simple, " << deep.models.size() << " deep-space, " << kTimes << " times" << std::endl;
+
+    std::vector<double> times;
+    for (size_t t = 0; t < kTimes; t++)
+    {
+        times.push_back(60.0 + 173.0 * static_cast<double>(t));
+    }
+
+    std::vector<Vector> ref_pos(models.size() * kTimes);
+    std::vector<Vector> ref_vel(models.size() * kTimes);
+    std::vector<Vector> pos(models.size() * kTimes);
+    std::vector<Vector> vel(models.size() * kTimes);
+
+    /*
+     * best of several runs of each, as the catalog is small enough to be
+     * disturbed by anything else running
+     */
+    double runtime_ms = 1.0e30;
+    double batch_ms = 1.0e30;
+    double grouped_ms = 1.0e30;
+    double group_ms[3] = {1.0e30, 1.0e30, 1.0e30};
+    for (size_t r = 0; r < kRepetitions; r++)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < kTimes; t++)
+        {
+            for (size_t i = 0; i < models.size(); i++)
+            {
+                const Eci eci = models[i].FindPosition(times[t]);
+                ref_pos[t * models.size() + i] = eci.Position();
+                ref_vel[t * models.size() + i] = eci.Velocity();
+            }
+        }
+        runtime_ms = std::min(runtime_ms, ElapsedMs(start));
+
+        start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < kTimes; t++)
+        {
+            for (size_t i = 0; i < models.size(); i++)
+            {
+                models[i].FindPositions(&times[t], 1, &pos[t * models.size() + i], &vel[t * models.size() + i]);
+            }
+        }
+        batch_ms = std::min(batch_ms, ElapsedMs(start));
+
+        double split[3] = {0.0, 0.0, 0.0};
+        start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < kTimes; t++)
+        {
+            Vector *p = &pos[t * models.size()];
+            Vector *v = &vel[t * models.size()];
+
+            std::chrono::steady_clock::time_point group = std::chrono::steady_clock::now();
+            PropagateGroup<false, false>(near, times[t], p, v);
+            split[0] += ElapsedMs(group);
+
+            group = std::chrono::steady_clock::now();
+            PropagateGroup<false, true>(simple, times[t], p, v);
+            split[1] += ElapsedMs(group);
+
+            group = std::chrono::steady_clock::now();
+            PropagateGroup<true, false>(deep, times[t], p, v);
+            split[2] += ElapsedMs(group);
+        }
+        grouped_ms = std::min(grouped_ms, ElapsedMs(start));
+        for (int g = 0; g < 3; g++)
+        {
+            group_ms[g] = std::min(group_ms[g], split[g]);
+        }
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < pos.size(); i++)
+    {
+        if (pos[i].x != ref_pos[i].x || pos[i].y != ref_pos[i].y || pos[i].z != ref_pos[i].z ||
+            vel[i].x != ref_vel[i].x || vel[i].y != ref_vel[i].y || vel[i].z != ref_vel[i].z)
+        {
+            mismatches++;
+        }
+    }
+
+    const double samples = static_cast<double>(models.size() * kTimes);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "FindPosition, catalog order:  " << std::setw(8) << runtime_ms << " ms "
+              << std::setw(8) << runtime_ms * 1.0e6 / samples << " ns/object" << std::endl;
+    std::cout << "FindPositions, catalog order: " << std::setw(8) << batch_ms << " ms "
+              << std::setw(8) << batch_ms * 1.0e6 / samples << " ns/object (" << runtime_ms / batch_ms << "x)" << std::endl;
+    std::cout << "grouped, compile-time model:  " << std::setw(8) << grouped_ms << " ms "
+              << std::setw(8) << grouped_ms * 1.0e6 / samples << " ns/object (" << runtime_ms / grouped_ms << "x)" << std::endl;
+    std::cout << "  near-space " << group_ms[0] * 1.0e6 / (near.models.size() * kTimes)
+              << " ns/object, simple " << group_ms[1] * 1.0e6 / (simple.models.size() * kTimes)
+              << " ns/object, deep-space " << group_ms[2] * 1.0e6 / (deep.models.size() * kTimes) << " ns/object" << std::endl;
+    std::cout << "mismatches: " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file parallelbench.cpp
+ * @brief Propagates a synthetic catalog over a day of sample times on thread
+ * pools of several sizes, checking every result against a serial run one time
+ * at a time and reporting the time taken by each.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SatelliteCatalogPropagator.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * base orbits the catalog is generated from: regular LEO, low perigee LEO
+ * (simple model), GPS and GEO (deep space)
+ */
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 28057U 03049A   06177.78615833  .00000060  00000-0  35940-4 0  1836",
+     "2 28057  98.4283 247.6961 0000884  88.1964 271.9322 14.35478080140550"},
+    {"1 29238U 06022G   06177.28732010  .00766286  10823-4  13334-2 0   101",
+     "2 29238  51.5595 213.7903 0202579  95.2503 267.9010 15.73823839  1061"},
+    {"1 28129U 03058A   06175.57071136 -.00000104  00000-0  10000-3 0   459",
+     "2 28129  54.7298 324.8098 0048506 266.2640  93.1663  2.00562768 18443"},
+    {"1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+     "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981"}};
+
+/*
+ * mostly near-space objects, as in the public catalog
+ */
+static const unsigned int kBaseWeights[] = {40, 30, 10, 10, 10};
+
+static const char *kEpoch = "21337.49738641";
+
+static std::vector<Tle> GenerateCatalog(size_t n)
+{
+    std::vector<Tle> tles;
+    tles.reserve(n);
+
+    const size_t nbase = sizeof(kBaseWeights) / sizeof(kBaseWeights[0]);
+    size_t slot = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        size_t base = 0;
+        size_t acc = kBaseWeights[0];
+        while (slot % 100 >= acc && base + 1 < nbase)
+        {
+            acc += kBaseWeights[++base];
+        }
+        slot++;
+
+        const unsigned int norad = static_cast<unsigned int>(i % 99999) + 1;
+        const double raan = static_cast<double>((i * 37) % 3600) / 10.0;
+        const double anomaly = static_cast<double>((i * 101) % 3600) / 10.0;
+
+        char l1[128];
+        char l2[128];
+        /*
+         * common epoch for the whole catalog
+         */
+        snprintf(l1, sizeof(l1), "1 %05u%.11s%s%s",
+                 norad, kBaseTles[base][0] + 7, kEpoch, kBaseTles[base][0] + 32);
+        snprintf(l2, sizeof(l2), "2 %05u %.8s %8.4f %.17s%8.4f%s",
+                 norad, kBaseTles[base][1] + 8, raan, kBaseTles[base][1] + 26, anomaly, kBaseTles[base][1] + 51);
+
+        tles.push_back(Tle(l1, l2));
+    }
+
+    return tles;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool Same(const Vector &a, const Vector &b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+int main()
+{
+    const size_t n = 10000;
+    const size_t count = 96;
+    std::vector<Tle> tles = GenerateCatalog(n);
+    SatelliteCatalogPropagator catalog(tles);
+
+    /*
+     * one day at 15 minute steps
+     */
+    std::vector<DateTime> times;
+    for (size_t t = 0; t < count; t++)
+    {
+        times.push_back(tles[0].Epoch().AddMinutes(15.0 * static_cast<double>(t)));
+    }
+
+    /*
+     * reference: one time after the other, stored object by object
+     */
+    std::vector<Vector> ref_pos(n * count);
+    std::vector<Vector> ref_vel(n * count);
+    std::vector<char> ref_valid(n * count);
+    std::vector<Vector> pos(n);
+    std::vector<Vector> vel(n);
+    bool *valid = new bool[n * count];
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < count; t++)
+    {
+        catalog.FindPositions(times[t], pos.data(), vel.data(), valid);
+        for (size_t i = 0; i < n; i++)
+        {
+            ref_pos[i * count + t] = pos[i];
+            ref_vel[i * count + t] = vel[i];
+            ref_valid[i * count + t] = valid[i];
+        }
+    }
+    const double serial_ms = ElapsedMs(start);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << n << " objects (" << catalog.NearSpaceCount() << " near-space) x " << count << " times" << std::endl;
+    std::cout << "serial:     " << serial_ms << " ms" << std::endl;
+
+    const size_t hardware = std::thread::hardware_concurrency();
+    const size_t sizes[] = {1, 2, 4, hardware > 4 ? hardware : 8};
+
+    size_t mismatches = 0;
+    pos.resize(n * count);
+    vel.resize(n * count);
+    for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+    {
+        ThreadPool pool(sizes[k]);
+
+        start = std::chrono::steady_clock::now();
+        catalog.FindPositions(times.data(), count, pool, pos.data(), vel.data(), valid);
+        const double pool_ms = ElapsedMs(start);
+
+        for (size_t i = 0; i < n * count; i++)
+        {
+            if (valid[i] != (ref_valid[i] != 0) || !Same(pos[i], ref_pos[i]) || !Same(vel[i], ref_vel[i]))
+            {
+                mismatches++;
+            }
+        }
+
+        std::cout << std::setw(3) << pool.Size() << " threads: " << pool_ms << " ms ("
+                  << serial_ms / pool_ms << "x)" << std::endl;
+    }
+    delete[] valid;
+
+    std::cout << "hardware threads: " << hardware << ", mismatches: " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
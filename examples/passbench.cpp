@@ -0,0 +1,183 @@
+/**
+ * @file passbench.cpp
+ * @brief Predicts a week of passes with PassPredictor and with a one second
+ * elevation scan, checking the two agree and reporting the time taken by each,
+ * then predicts the passes of a satellite that decays during the search,
+ * checking the search ends cleanly before decay.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <PassPredictor.hpp>
+#include <Util.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * a one second scan finds aos and los to within a second
+ */
+static const double kTimeTolerance = 1.0;
+
+/*
+ * aos, culmination and los as the one second scan finds them
+ */
+struct ScanPass
+{
+    DateTime aos;
+    DateTime los;
+    DateTime culmination;
+    double max_elevation;
+};
+
+static std::vector<ScanPass> ScanPasses(const SGP4 &sgp4,
+                                        Observer observer,
+                                        double min_elevation,
+                                        const DateTime &start,
+                                        int seconds)
+{
+    std::vector<ScanPass> passes;
+    bool in_pass = false;
+    ScanPass pass;
+
+    for (int i = 0; i <= seconds; i++)
+    {
+        const DateTime t = start.AddSeconds(i);
+        const double el = observer.GetLookAngle(sgp4.FindPosition(t)).elevation;
+
+        if (el > min_elevation)
+        {
+            if (!in_pass)
+            {
+                pass.aos = t;
+                pass.max_elevation = el;
+                pass.culmination = t;
+                in_pass = true;
+            }
+            if (el > pass.max_elevation)
+            {
+                pass.max_elevation = el;
+                pass.culmination = t;
+            }
+        }
+        else if (in_pass)
+        {
+            pass.los = t;
+            passes.push_back(pass);
+            in_pass = false;
+        }
+    }
+
+    return passes;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const Tle tle("ISS (ZARYA)",
+                  "1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+                  "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838");
+    const SGP4 sgp4(tle);
+    const Observer observer(42.655583, -71.325433, 0.061);
+    const double min_elevation = Util::DegreesToRadians(10.0);
+    const int days = 7;
+
+    const DateTime start = tle.Epoch();
+    const DateTime end = start.AddDays(days);
+
+    std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+    std::vector<ScanPass> scan = ScanPasses(sgp4, observer, min_elevation, start, days * 86400);
+    const double scan_ms = ElapsedMs(timer);
+
+    PassPredictor predictor(sgp4, observer, min_elevation);
+    timer = std::chrono::steady_clock::now();
+    std::vector<PassDetails> passes = predictor.FindPasses(start, end);
+    const double predictor_ms = ElapsedMs(timer);
+
+    bool ok = scan.size() == passes.size();
+    double max_aos = 0.0;
+    double max_los = 0.0;
+    double max_elevation = 0.0;
+    for (size_t i = 0; ok && i < passes.size(); i++)
+    {
+        /*
+         * the scan reports the first second above and the first below
+         */
+        const double aos = (scan[i].aos - passes[i].aos).TotalSeconds();
+        const double los = (scan[i].los - passes[i].los).TotalSeconds();
+        const double elevation = passes[i].culmination_look_angle.elevation - scan[i].max_elevation;
+        max_aos = std::max(max_aos, fabs(aos));
+        max_los = std::max(max_los, fabs(los));
+        max_elevation = std::max(max_elevation, fabs(elevation));
+
+        ok = ok && aos >= 0.0 && aos <= kTimeTolerance && los >= 0.0 && los <= kTimeTolerance && elevation >= 0.0;
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << days << " days, " << passes.size() << " passes (scan " << scan.size() << ")" << std::endl;
+    std::cout << "scan:      " << scan_ms << " ms" << std::endl;
+    std::cout << "predictor: " << predictor_ms << " ms (" << scan_ms / predictor_ms << "x)" << std::endl;
+    std::cout << "largest difference aos " << max_aos << " s, los " << max_los << " s, max elevation "
+              << std::setprecision(4) << Util::RadiansToDegrees(max_elevation) << " deg"
+              << (ok ? "" : "  FAILED") << std::endl;
+
+    /*
+     * a satellite with so much drag it decays within hours of epoch
+     */
+    const Tle decaying_tle("DECAYING",
+                           "1 28872U 05037B   05333.02012661  .25992681  00000-0  24476-3 0  1534",
+                           "2 28872  96.4736 157.9986 0303955 244.0492 110.6523 16.46015938 10708");
+    const SGP4 decaying(decaying_tle);
+    const Observer station(70.0, 0.0, 0.1);
+
+    /*
+     * the first minute at which it fails to propagate
+     */
+    double decay_minutes = 0.0;
+    for (;; decay_minutes += 1.0)
+    {
+        SGP4::IntegratorParams state;
+        Vector position;
+        Vector velocity;
+        if (decaying.FindPosition(decay_minutes, state, position, velocity) != SGP4::OK)
+        {
+            break;
+        }
+    }
+    const DateTime decay = decaying_tle.Epoch().AddMinutes(decay_minutes);
+
+    bool decay_ok = true;
+    std::vector<PassDetails> decaying_passes;
+    try
+    {
+        PassPredictor decaying_predictor(decaying, station, 0.0);
+        decaying_passes = decaying_predictor.FindPasses(decaying_tle.Epoch(), decaying_tle.Epoch().AddDays(1.0));
+    }
+    catch (std::exception &)
+    {
+        decay_ok = false;
+    }
+    for (size_t i = 0; i < decaying_passes.size(); i++)
+    {
+        decay_ok = decay_ok && decaying_passes[i].los < decay;
+    }
+    decay_ok = decay_ok && !decaying_passes.empty();
+
+    std::cout << "decaying satellite: " << decaying_passes.size() << " passes before decay at "
+              << std::setprecision(0) << decay_minutes << " min" << (decay_ok ? "" : "  FAILED") << std::endl;
+
+    return ok && decay_ok ? 0 : 1;
+}
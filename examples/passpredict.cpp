@@ -20,6 +20,7 @@
 #include "CoordTopocentric.hpp"
 #include "DateTime.hpp"
 #include "Observer.hpp"
+#include "PassPredictor.hpp"
 #include "SGP4.hpp"
 #include "meb_print.h"
 
@@ -187,12 +188,6 @@ int main(int argc, char *argv[])
     bprintlf(YELLOW_FG "DATA FOR %d DAYS", days_to_predict);
 
     bprintlf("Current Position: %.2f AZ, %.2f EL | %.2f LA, %.2f LN", current_pos.azimuth DEG, current_pos.elevation DEG, current_lla.latitude DEG, current_lla.longitude DEG);
-    DateTime tnext = tnow;
-    bool in_pass = false;
-    double max_el = 0.0;
-    double max_el_az = 0.0;
-    DateTime max_el_time;
-    int begin_et = 0;
 
     TimeSpan FiveHours(5, 0, 0);
     DateTime tEST = tnow - FiveHours;
@@ -209,72 +204,54 @@ int main(int argc, char *argv[])
 
     bprintlf("It is currently %04d.%02d.%02d %02d:%02d:%02d EST\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second());
 
-    for (int i = 0; i < 86400 * days_to_predict; i++)
-    {
-        tnext = tnext.AddSeconds(1);
-        Eci eci_ahd = satellite->FindPosition(tnext);
-        CoordTopocentric pos_ahd = dish->GetLookAngle(eci_ahd);
-        double ahd_el = pos_ahd.elevation DEG;
-        if (ahd_el > 10.0)
-        {
-            if (!in_pass)
-            {
-                bprintlf("== SATELLITE PASS (Now + %d minutes) ==", i / 60);
-                bprintlf("Time (EST)             Az (deg)   El (deg)");
-                bprintlf("------------------------------------------");
-                if (use_out_file)
-                {
-                    fprintf(fp_out, "== SATELLITE PASS (Now + %d minutes) ==\n", i / 60);
-                    fprintf(fp_out, "Time (EST)             Az (deg)   El (deg)\n");
-                    fprintf(fp_out, "------------------------------------------\n");
-                }
-                in_pass = true;
-                begin_et = i;
-            }
+    PassPredictor predictor(*satellite, *dish, Util::DegreesToRadians(MIN_ELEV));
+    std::vector<PassDetails> passes = predictor.FindPasses(tnow, tnow.AddDays(days_to_predict));
 
-            if (ahd_el > max_el)
-            {
-                max_el = ahd_el;
-                max_el_az = pos_ahd.azimuth DEG;
-                max_el_time = tnext;
-            }
-
-            // Print data for every 60 seconds after the pass begins, and once immediately when the pass begins..
-            if ((i - begin_et) % 60 == 0)
-            {
-
-                tEST = tnext - FiveHours;
-                bprintlf("%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pos_ahd.azimuth DEG, ahd_el);
+    for (size_t i = 0; i < passes.size(); i++)
+    {
+        const PassDetails &pass = passes[i];
+        int minutes = (int)(pass.aos - tnow).TotalMinutes();
 
-                if (use_out_file)
-                {
-                    fprintf(fp_out, "%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pos_ahd.azimuth DEG, ahd_el);
-                }
-            }
+        bprintlf("== SATELLITE PASS (Now + %d minutes) ==", minutes);
+        bprintlf("Time (EST)             Az (deg)   El (deg)");
+        bprintlf("------------------------------------------");
+        if (use_out_file)
+        {
+            fprintf(fp_out, "== SATELLITE PASS (Now + %d minutes) ==\n", minutes);
+            fprintf(fp_out, "Time (EST)             Az (deg)   El (deg)\n");
+            fprintf(fp_out, "------------------------------------------\n");
         }
-        else if (in_pass)
+
+        // Print data for every 60 seconds after the pass begins, and once immediately when the pass begins.
+        for (DateTime t = pass.aos; t < pass.los; t = t.AddSeconds(60))
         {
-            // Make sure to print final state when pass ends.
-            tEST = tnext - FiveHours;
-            bprintlf("%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pos_ahd.azimuth DEG, ahd_el);
+            CoordTopocentric pos_ahd = dish->GetLookAngle(satellite->FindPosition(t));
+            tEST = t - FiveHours;
+            bprintlf("%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pos_ahd.azimuth DEG, pos_ahd.elevation DEG);
 
             if (use_out_file)
             {
-                fprintf(fp_out, "%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pos_ahd.azimuth DEG, ahd_el);
+                fprintf(fp_out, "%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pos_ahd.azimuth DEG, pos_ahd.elevation DEG);
             }
+        }
 
-            bprintlf("Pass Statistics");
-            bprintlf("    Maximum Elevation:");
-            tEST = max_el_time - FiveHours;
-            bprintlf("%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), max_el_az, max_el);
-            printf("\n\n");
-            if (use_out_file)
-            {
-                fprintf(fp_out, "\nPass Statistics\n    Maximum Elevation:\n%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n\n\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), max_el_az, max_el);
-            }
+        // Make sure to print final state when pass ends.
+        tEST = pass.los - FiveHours;
+        bprintlf("%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pass.los_look_angle.azimuth DEG, pass.los_look_angle.elevation DEG);
 
-            in_pass = false;
-            max_el = 0;
+        if (use_out_file)
+        {
+            fprintf(fp_out, "%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pass.los_look_angle.azimuth DEG, pass.los_look_angle.elevation DEG);
+        }
+
+        bprintlf("Pass Statistics");
+        bprintlf("    Maximum Elevation:");
+        tEST = pass.culmination - FiveHours;
+        bprintlf("%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pass.culmination_look_angle.azimuth DEG, pass.culmination_look_angle.elevation DEG);
+        printf("\n\n");
+        if (use_out_file)
+        {
+            fprintf(fp_out, "\nPass Statistics\n    Maximum Elevation:\n%04d.%02d.%02d %02d:%02d:%02d    %6.02lf     %6.02lf\n\n\n", tEST.Year(), tEST.Month(), tEST.Day(), tEST.Hour(), tEST.Minute(), tEST.Second(), pass.culmination_look_angle.azimuth DEG, pass.culmination_look_angle.elevation DEG);
         }
     }
 
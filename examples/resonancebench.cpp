@@ -0,0 +1,234 @@
+/**
+ * @file resonancebench.cpp
+ * @brief Propagates GPS, Molniya and GEO objects at shuffled times over a
+ * 30 day span, comparing integration from epoch, a caller-owned integrator
+ * state and the integrator checkpoints, and checking all three agree, also
+ * with a caller-owned state and checkpoints together and with several
+ * threads reading the checkpoints of copies of one model. Also steps each
+ * object a second at a time from 30 days after epoch with the plain
+ * FindPosition(DateTime), checking it costs about as much as continuing a
+ * caller-owned state, as the model's own integrator state once did.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SGP4.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace LSGP4;
+
+static double ElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool Same(const std::vector<Vector> &a, const std::vector<Vector> &b)
+{
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (a[i].x != b[i].x || a[i].y != b[i].y || a[i].z != b[i].z)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool RunBenchmark(const char *label, const Tle &tle, const std::vector<double> &tsince)
+{
+    const size_t n = tsince.size();
+    std::vector<Vector> from_epoch(n);
+    std::vector<Vector> with_state(n);
+    std::vector<Vector> cold(n);
+    std::vector<Vector> warm(n);
+
+    SGP4 plain(tle);
+    plain.SetIntegratorCheckpoints(false);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        from_epoch[i] = plain.FindPosition(tsince[i]).Position();
+    }
+    const double epoch_ns = ElapsedNs(start) / n;
+
+    SGP4::IntegratorParams state;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        with_state[i] = plain.FindPosition(tsince[i], state).Position();
+    }
+    const double state_ns = ElapsedNs(start) / n;
+
+    /*
+     * the first pass builds the checkpoints
+     */
+    SGP4 checkpointed(tle);
+    checkpointed.SetIntegratorCheckpoints(true);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        cold[i] = checkpointed.FindPosition(tsince[i]).Position();
+    }
+    const double cold_ns = ElapsedNs(start) / n;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        warm[i] = checkpointed.FindPosition(tsince[i]).Position();
+    }
+    const double warm_ns = ElapsedNs(start) / n;
+
+    /*
+     * the caller's state is kept where it is closer than a checkpoint
+     */
+    std::vector<Vector> both(n);
+    SGP4::IntegratorParams checkpointed_state;
+    for (size_t i = 0; i < n; i++)
+    {
+        both[i] = checkpointed.FindPosition(tsince[i], checkpointed_state).Position();
+    }
+
+    /*
+     * copies share the checkpoints, which a fresh model builds while the
+     * threads read them
+     */
+    SGP4 shared(tle);
+    shared.SetIntegratorCheckpoints(true);
+    const size_t thread_count = 4;
+    std::vector<std::vector<Vector> > threaded(thread_count, std::vector<Vector>(n));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; t++)
+    {
+        threads.push_back(std::thread([&, t]()
+        {
+            const SGP4 copy(shared);
+            for (size_t i = 0; i < n; i++)
+            {
+                const size_t k = (i + t * n / thread_count) % n;
+                threaded[t][k] = copy.FindPosition(tsince[k]).Position();
+            }
+        }));
+    }
+    bool threads_match = true;
+    for (size_t t = 0; t < thread_count; t++)
+    {
+        threads[t].join();
+        threads_match = Same(from_epoch, threaded[t]) && threads_match;
+    }
+
+    const bool match = Same(from_epoch, with_state) && Same(from_epoch, cold) && Same(from_epoch, warm) &&
+                       Same(from_epoch, both) && threads_match;
+
+    std::cout << std::fixed << std::setprecision(1) << std::left << std::setw(5) << label
+              << " from epoch: " << std::setw(8) << epoch_ns << " ns/op"
+              << "  state: " << std::setw(8) << state_ns << " ns/op"
+              << "  checkpoints cold: " << std::setw(7) << cold_ns << " ns/op"
+              << "  warm: " << std::setw(7) << warm_ns << " ns/op"
+              << "  speedup: " << std::setprecision(2) << epoch_ns / warm_ns << "x"
+              << (match ? "" : "  MISMATCH") << std::endl;
+
+    return match;
+}
+
+/*
+ * the stateless overloads start from the checkpoints, which a tracking loop
+ * far from epoch must not pay for with an integration from epoch each call
+ */
+static bool RunStepping(const char *label, const Tle &tle)
+{
+    const size_t n = 20000;
+    const SGP4 sgp4(tle);
+    const DateTime start_date = tle.Epoch().AddDays(30.0);
+    std::vector<Vector> plain(n);
+    std::vector<Vector> with_state(n);
+    std::vector<Vector> no_checkpoints(n);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        plain[i] = sgp4.FindPosition(start_date.AddSeconds(static_cast<double>(i))).Position();
+    }
+    const double plain_ns = ElapsedNs(start) / n;
+
+    SGP4::IntegratorParams state;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        with_state[i] = sgp4.FindPosition(start_date.AddSeconds(static_cast<double>(i)), state).Position();
+    }
+    const double state_ns = ElapsedNs(start) / n;
+
+    SGP4 unchecked(tle);
+    unchecked.SetIntegratorCheckpoints(false);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++)
+    {
+        no_checkpoints[i] = unchecked.FindPosition(start_date.AddSeconds(static_cast<double>(i))).Position();
+    }
+    const double no_checkpoints_ns = ElapsedNs(start) / n;
+
+    /*
+     * a loose bound, as integrating from epoch each call costs ten times
+     * more at 30 days and grows with the time since epoch
+     */
+    const bool match = Same(plain, with_state) && Same(plain, no_checkpoints);
+    const bool fast = plain_ns < 3.0 * state_ns;
+
+    std::cout << std::fixed << std::setprecision(1) << std::left << std::setw(5) << label
+              << " stepping from +30 d: " << std::setw(8) << plain_ns << " ns/op"
+              << "  state: " << std::setw(8) << state_ns << " ns/op"
+              << "  without checkpoints: " << std::setw(8) << no_checkpoints_ns << " ns/op"
+              << (match ? "" : "  MISMATCH") << (fast ? "" : "  SLOW") << std::endl;
+
+    return match && fast;
+}
+
+int main()
+{
+    const size_t n = 20000;
+
+    /*
+     * 30 days after epoch, in random order
+     */
+    std::vector<double> tsince(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        tsince[i] = 30.0 * 1440.0 * static_cast<double>(i) / n;
+    }
+    std::mt19937 rng(20261016);
+    std::shuffle(tsince.begin(), tsince.end(), rng);
+
+    Tle gps("GPS",
+            "1 28129U 03058A   06175.57071136 -.00000104  00000-0  10000-3 0   459",
+            "2 28129  54.7298 324.8098 0048506 266.2640  93.1663  2.00562768 18443");
+    /*
+     * 12 hour resonance needs a Molniya-like eccentricity, so GPS itself
+     * runs without the integrator
+     */
+    Tle molniya("MOLN",
+                "1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+                "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656");
+    Tle geo("GEO",
+            "1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+            "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981");
+
+    bool ok = RunBenchmark("GPS", gps, tsince);
+    ok = RunBenchmark("MOLN", molniya, tsince) && ok;
+    ok = RunBenchmark("GEO", geo, tsince) && ok;
+
+    ok = RunStepping("MOLN", molniya) && ok;
+    ok = RunStepping("GEO", geo) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file schedulebench.cpp
+ * @brief Schedules two days of contacts between a constellation and a network
+ * of ground stations with VisibilityScheduler and with one PassPredictor per
+ * pair, checking the two schedules agree and reporting the time taken by each.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <VisibilityScheduler.hpp>
+#include <Util.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kSatellites = 100;
+static const size_t kStations = 24;
+
+/*
+ * a Walker-like spread of ISS-like orbits
+ */
+static std::vector<SGP4> GenerateSatellites(size_t n)
+{
+    std::vector<SGP4> satellites;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const double raan = static_cast<double>((i * 37) % 3600) / 10.0;
+        const double anomaly = static_cast<double>((i * 101) % 3600) / 10.0;
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05uU 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+                 static_cast<unsigned int>(i + 1));
+        snprintf(l2, sizeof(l2), "2 %05u  51.6389 %8.4f 0004535 264.0051 %8.4f 15.48792552314838",
+                 static_cast<unsigned int>(i + 1), raan, anomaly);
+
+        satellites.push_back(SGP4(Tle(l1, l2)));
+    }
+
+    return satellites;
+}
+
+/*
+ * stations spread over the northern and southern mid latitudes
+ */
+static std::vector<Observer> GenerateStations(size_t n)
+{
+    std::vector<Observer> stations;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const double latitude = (i % 2 == 0 ? 1.0 : -1.0) * (20.0 + static_cast<double>(i % 5) * 8.0);
+        const double longitude = -180.0 + 360.0 * static_cast<double>(i) / n;
+        stations.push_back(Observer(latitude, longitude, 0.1));
+    }
+
+    return stations;
+}
+
+static bool ContactBefore(const Contact &a, const Contact &b)
+{
+    if (a.pass.aos != b.pass.aos)
+    {
+        return a.pass.aos < b.pass.aos;
+    }
+    if (a.satellite != b.satellite)
+    {
+        return a.satellite < b.satellite;
+    }
+    return a.station < b.station;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    const std::vector<SGP4> satellites = GenerateSatellites(kSatellites);
+    const std::vector<Observer> stations = GenerateStations(kStations);
+    const double min_elevation = Util::DegreesToRadians(5.0);
+    const DateTime start = satellites[0].GetTle().Epoch();
+    const DateTime end = start.AddDays(2.0);
+
+    /*
+     * one predictor per pair, each propagating the satellite itself
+     */
+    std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+    std::vector<Contact> reference;
+    for (size_t i = 0; i < satellites.size(); i++)
+    {
+        for (size_t k = 0; k < stations.size(); k++)
+        {
+            PassPredictor predictor(satellites[i], stations[k], min_elevation);
+            std::vector<PassDetails> passes = predictor.FindPasses(start, end);
+            for (size_t p = 0; p < passes.size(); p++)
+            {
+                Contact contact = {i, k, passes[p]};
+                reference.push_back(contact);
+            }
+        }
+    }
+    std::sort(reference.begin(), reference.end(), ContactBefore);
+    const double pairs_ms = ElapsedMs(timer);
+
+    VisibilityScheduler scheduler(satellites, stations, min_elevation);
+    timer = std::chrono::steady_clock::now();
+    std::vector<Contact> contacts = scheduler.FindContacts(start, end);
+    const double scheduler_ms = ElapsedMs(timer);
+
+    size_t mismatches = contacts.size() == reference.size() ? 0 : 1;
+    for (size_t i = 0; mismatches == 0 && i < contacts.size(); i++)
+    {
+        if (contacts[i].satellite != reference[i].satellite ||
+            contacts[i].station != reference[i].station ||
+            contacts[i].pass.aos != reference[i].pass.aos ||
+            contacts[i].pass.culmination != reference[i].pass.culmination ||
+            contacts[i].pass.los != reference[i].pass.los)
+        {
+            mismatches++;
+        }
+    }
+
+    bool sorted = true;
+    for (size_t i = 1; i < contacts.size(); i++)
+    {
+        sorted = sorted && !(contacts[i].pass.aos < contacts[i - 1].pass.aos);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << kSatellites << " satellites x " << kStations << " stations, "
+              << contacts.size() << " contacts in 2 days" << std::endl;
+    std::cout << "per pair:  " << pairs_ms << " ms" << std::endl;
+    std::cout << "scheduler: " << scheduler_ms << " ms (" << pairs_ms / scheduler_ms << "x)" << std::endl;
+    std::cout << "mismatches: " << mismatches << (sorted ? "" : ", NOT SORTED") << std::endl;
+
+    return mismatches == 0 && sorted ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+/**
+ * @file shelltest.cpp
+ * @brief Builds a ShellIndex over a synthetic catalog, checking its queries
+ * against a scan of every object and reporting the time each takes and the
+ * share of catalog pairs the index rules out of a conjunction screening.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <ShellIndex.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kCatalogSize = 25000;
+static const size_t kQueries = 2000;
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * mostly LEO, with MEO, GEO, Molniya and transfer orbits
+ */
+static std::vector<SGP4> MakeCatalog()
+{
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    std::vector<SGP4> catalog;
+    for (size_t i = 0; i < kCatalogSize; i++)
+    {
+        double mean_motion = 13.0 + 3.0 * unit(generator);
+        double eccentricity = 0.02 * unit(generator) * unit(generator);
+        switch (i % 20)
+        {
+        case 0:
+            mean_motion = 2.0 + 0.01 * unit(generator);
+            break;
+        case 1:
+            mean_motion = 1.0027 + 0.001 * unit(generator);
+            eccentricity = 0.001 * unit(generator);
+            break;
+        case 2:
+            mean_motion = 2.006;
+            eccentricity = 0.6 + 0.1 * unit(generator);
+            break;
+        case 3:
+            mean_motion = 2.2 + 0.2 * unit(generator);
+            eccentricity = 0.7 + 0.03 * unit(generator);
+            break;
+        default:
+            break;
+        }
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05uU 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+                 static_cast<unsigned int>(i % 99999) + 1);
+        snprintf(l2, sizeof(l2), "2 %05u %8.4f %8.4f %07d %8.4f %8.4f %11.8f100000",
+                 static_cast<unsigned int>(i % 99999) + 1,
+                 180.0 * unit(generator), 360.0 * unit(generator),
+                 static_cast<int>(eccentricity * 1.0e7),
+                 360.0 * unit(generator), 360.0 * unit(generator), mean_motion);
+        catalog.push_back(SGP4(Tle(l1, l2)));
+    }
+    return catalog;
+}
+
+int main()
+{
+    const std::vector<SGP4> catalog = MakeCatalog();
+    size_t failures = 0;
+
+    std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+    const ShellIndex index(catalog);
+    const double build_ms = ElapsedMs(timer);
+
+    /*
+     * the same shells from the decoded element sets
+     */
+    TleCatalog records;
+    for (size_t i = 0; i < catalog.size(); i++)
+    {
+        records.Add(catalog[i].GetRecord(), "", 0);
+    }
+    const ShellIndex record_index(records);
+    for (size_t i = 0; i < catalog.size(); i++)
+    {
+        if (record_index.Perigee(i) != index.Perigee(i) || record_index.Apogee(i) != index.Apogee(i))
+        {
+            failures++;
+        }
+    }
+
+    /*
+     * random altitude bands and orbits, against a scan of every shell
+     */
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> altitude(100.0, 40000.0);
+    std::uniform_real_distribution<double> width(0.0, 500.0);
+    std::vector<double> lows(kQueries);
+    std::vector<double> highs(kQueries);
+    for (size_t q = 0; q < kQueries; q++)
+    {
+        lows[q] = altitude(generator);
+        highs[q] = lows[q] + width(generator);
+    }
+
+    std::vector<size_t> found;
+    size_t found_count = 0;
+    timer = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < kQueries; q++)
+    {
+        found.clear();
+        index.FindInBand(lows[q], highs[q], found);
+        found_count += found.size();
+    }
+    const double index_ms = ElapsedMs(timer);
+
+    size_t scan_count = 0;
+    timer = std::chrono::steady_clock::now();
+    for (size_t q = 0; q < kQueries; q++)
+    {
+        found.clear();
+        const double low = lows[q] + 6378.135;
+        const double high = highs[q] + 6378.135;
+        for (size_t i = 0; i < catalog.size(); i++)
+        {
+            if (index.Perigee(i) <= high && index.Apogee(i) >= low)
+            {
+                found.push_back(i);
+            }
+        }
+        scan_count += found.size();
+    }
+    const double scan_ms = ElapsedMs(timer);
+
+    for (size_t q = 0; q < kQueries; q++)
+    {
+        found.clear();
+        index.FindInBand(lows[q], highs[q], found);
+        std::sort(found.begin(), found.end());
+
+        std::vector<size_t> expected;
+        const double low = lows[q] + 6378.135;
+        const double high = highs[q] + 6378.135;
+        for (size_t i = 0; i < catalog.size(); i++)
+        {
+            if (index.Perigee(i) <= high && index.Apogee(i) >= low)
+            {
+                expected.push_back(i);
+            }
+        }
+        if (found != expected || index.Overlaps(low, high) != !expected.empty())
+        {
+            failures++;
+        }
+    }
+
+    /*
+     * the pairs a screening at 10 km with a 100 km margin has to consider
+     */
+    size_t pairs = 0;
+    timer = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < catalog.size(); i++)
+    {
+        found.clear();
+        index.FindNear(catalog[i].GetOrbitalElements(), 110.0, found);
+        pairs += found.size();
+    }
+    const double pairs_ms = ElapsedMs(timer);
+
+    for (size_t i = 0; i < catalog.size(); i += 100)
+    {
+        found.clear();
+        index.FindNear(catalog[i].GetOrbitalElements(), 110.0, found);
+
+        size_t expected = 0;
+        for (size_t j = 0; j < catalog.size(); j++)
+        {
+            if (index.Perigee(j) <= index.Apogee(i) + 110.0 && index.Apogee(j) >= index.Perigee(i) - 110.0)
+            {
+                expected++;
+            }
+        }
+        if (expected != found.size())
+        {
+            failures++;
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << kCatalogSize << " objects, index built in " << build_ms << " ms" << std::endl;
+    std::cout << kQueries << " band queries: index " << index_ms << " ms, scan " << scan_ms << " ms ("
+              << scan_ms / index_ms << "x), " << found_count << " / " << scan_count << " found" << std::endl;
+    std::cout << "catalog pairs within 110 km shells: " << pairs << " of "
+              << static_cast<double>(kCatalogSize) * kCatalogSize << " ("
+              << 100.0 * pairs / (static_cast<double>(kCatalogSize) * kCatalogSize) << "%) in "
+              << pairs_ms << " ms" << std::endl;
+    std::cout << "failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
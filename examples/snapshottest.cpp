@@ -0,0 +1,291 @@
+/**
+ * @file snapshottest.cpp
+ * @brief Writes a synthetic catalog to a CatalogSnapshot and reads it back,
+ * checking the restored models propagate exactly as those initialised from
+ * the text, that damaged snapshots are rejected, and reporting the start up
+ * time of each path.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <CatalogSnapshot.hpp>
+#include <SatelliteCatalogPropagator.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kCatalogSize = 20000;
+static const char *kSnapshotFile = "snapshottest.tmp";
+
+/*
+ * regular LEO, low perigee LEO (simple model), GPS (resonant), Molniya
+ * (resonant) and GEO (synchronous)
+ */
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 29238U 06022G   06177.28732010  .00766286  10823-4  13334-2 0   101",
+     "2 29238  51.5595 213.7903 0202579  95.2503 267.9010 15.73823839  1061"},
+    {"1 28129U 03058A   06175.57071136 -.00000104  00000-0  10000-3 0   459",
+     "2 28129  54.7298 324.8098 0048506 266.2640  93.1663  2.00562768 18443"},
+    {"1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656"},
+    {"1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+     "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981"}};
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool SameEci(const Eci &a, const Eci &b)
+{
+    return a.Position().x == b.Position().x && a.Position().y == b.Position().y &&
+           a.Position().z == b.Position().z && a.Velocity().x == b.Velocity().x &&
+           a.Velocity().y == b.Velocity().y && a.Velocity().z == b.Velocity().z;
+}
+
+/*
+ * the minutes since epoch each model is checked at, reaching back and
+ * forward several resonance integrator steps
+ */
+static const double kTimes[] = {-2880.0, -360.0, 0.0, 97.5, 1440.0, 4321.0, 10080.0};
+
+static size_t CompareModels(const SGP4 &a, const SGP4 &b)
+{
+    size_t mismatches = 0;
+    for (size_t t = 0; t < sizeof(kTimes) / sizeof(kTimes[0]); t++)
+    {
+        bool a_failed = false;
+        bool b_failed = false;
+        const Vector zero;
+        Eci ea(DateTime(0), zero);
+        Eci eb(DateTime(0), zero);
+        try
+        {
+            ea = a.FindPosition(kTimes[t]);
+        }
+        catch (SatelliteException &)
+        {
+            a_failed = true;
+        }
+        try
+        {
+            eb = b.FindPosition(kTimes[t]);
+        }
+        catch (SatelliteException &)
+        {
+            b_failed = true;
+        }
+        if (a_failed != b_failed || (!a_failed && !SameEci(ea, eb)))
+        {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+/*
+ * damage a copy of the snapshot and check it is rejected
+ */
+static size_t CheckRejected(const std::vector<char> &bytes, size_t offset, size_t truncate_to)
+{
+    std::vector<char> damaged(bytes.begin(), bytes.begin() + truncate_to);
+    if (offset < damaged.size())
+    {
+        damaged[offset] ^= 0x01;
+    }
+
+    FILE *fp = fopen(kSnapshotFile, "wb");
+    fwrite(damaged.data(), 1, damaged.size(), fp);
+    fclose(fp);
+
+    try
+    {
+        CatalogSnapshot snapshot(kSnapshotFile);
+    }
+    catch (std::invalid_argument &)
+    {
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * a snapshot of another version is reported as such, even when its entries
+ * have changed size too
+ */
+static size_t CheckVersionReported(std::vector<char> bytes)
+{
+    bytes[8] ^= 0x01;
+    bytes[16] ^= 0x08;
+
+    FILE *fp = fopen(kSnapshotFile, "wb");
+    fwrite(bytes.data(), 1, bytes.size(), fp);
+    fclose(fp);
+
+    try
+    {
+        CatalogSnapshot snapshot(kSnapshotFile);
+    }
+    catch (std::invalid_argument &e)
+    {
+        return strcmp(e.what(), "Unsupported catalog snapshot version") == 0 ? 0 : 1;
+    }
+    return 1;
+}
+
+int main()
+{
+    std::vector<std::string> line1;
+    std::vector<std::string> line2;
+    for (size_t i = 0; i < kCatalogSize; i++)
+    {
+        const char **base = kBaseTles[i % 5];
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05u%.62s", static_cast<unsigned int>(i % 99999) + 1, base[0] + 7);
+        snprintf(l2, sizeof(l2), "2 %05u%.10s%8.4f%.18s%8.4f%.18s",
+                 static_cast<unsigned int>(i % 99999) + 1, base[1] + 7,
+                 static_cast<double>((i * 37) % 3600000) / 10000.0, base[1] + 25,
+                 static_cast<double>((i * 101) % 3600000) / 10000.0, base[1] + 51);
+        line1.push_back(l1);
+        line2.push_back(l2);
+    }
+
+    /*
+     * the text path: decode and initialise every model
+     */
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<SGP4> reference;
+    reference.reserve(kCatalogSize);
+    for (size_t i = 0; i < kCatalogSize; i++)
+    {
+        reference.push_back(SGP4(Tle(line1[i], line2[i])));
+    }
+    const double text_ms = ElapsedMs(start);
+
+    CatalogSnapshot::Write(kSnapshotFile, reference);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<SGP4> restored;
+    {
+        CatalogSnapshot snapshot(kSnapshotFile);
+        restored = snapshot.Satellites();
+    }
+    const double snapshot_ms = ElapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    size_t size;
+    {
+        CatalogSnapshot snapshot(kSnapshotFile);
+        size = snapshot.Size();
+        SatelliteCatalogPropagator propagator(snapshot.Satellites());
+    }
+    const double propagator_ms = ElapsedMs(start);
+
+    size_t mismatches = 0;
+    size_t record_mismatches = 0;
+    {
+        CatalogSnapshot snapshot(kSnapshotFile);
+        if (restored.size() != kCatalogSize || size != kCatalogSize)
+        {
+            mismatches++;
+        }
+        for (size_t i = 0; i < restored.size() && i < kCatalogSize; i++)
+        {
+            mismatches += CompareModels(reference[i], restored[i]);
+
+            const Tle &tle = reference[i].GetTle();
+            const TleRecord &record = snapshot.Record(i);
+            if (tle.NoradNumber() != record.norad_number ||
+                tle.IntDesignator() != record.int_designator ||
+                tle.Epoch().Ticks() != record.epoch ||
+                tle.BStar() != record.bstar ||
+                tle.Inclination(true) != record.inclination ||
+                tle.MeanMotion() != record.mean_motion ||
+                restored[i].HasTle() ||
+                restored[i].GetOrbitalElements().Epoch() != tle.Epoch())
+            {
+                record_mismatches++;
+            }
+        }
+    }
+
+    /*
+     * the whole catalog through the propagator, scalar so it is exact
+     */
+    {
+        std::vector<Tle> tles;
+        for (size_t i = 0; i < kCatalogSize; i++)
+        {
+            tles.push_back(Tle(line1[i], line2[i]));
+        }
+        SatelliteCatalogPropagator from_text(tles);
+        SatelliteCatalogPropagator from_snapshot(restored);
+        from_text.SetKernelIsa(NearSpaceKernel::SCALAR);
+        from_snapshot.SetKernelIsa(NearSpaceKernel::SCALAR);
+
+        const DateTime dt = tles[0].Epoch().AddDays(1.5);
+        std::vector<Vector> p1(kCatalogSize), v1(kCatalogSize), p2(kCatalogSize), v2(kCatalogSize);
+        std::unique_ptr<bool[]> ok1(new bool[kCatalogSize]);
+        std::unique_ptr<bool[]> ok2(new bool[kCatalogSize]);
+        from_text.FindPositions(dt, p1.data(), v1.data(), ok1.get());
+        from_snapshot.FindPositions(dt, p2.data(), v2.data(), ok2.get());
+        for (size_t i = 0; i < kCatalogSize; i++)
+        {
+            if (ok1[i] != ok2[i] || p1[i].x != p2[i].x || p1[i].y != p2[i].y || p1[i].z != p2[i].z ||
+                v1[i].x != v2[i].x || v1[i].y != v2[i].y || v1[i].z != v2[i].z)
+            {
+                mismatches++;
+            }
+        }
+    }
+
+    /*
+     * bad magic, bad version, truncated entries and a truncated header
+     */
+    std::vector<char> bytes;
+    {
+        FILE *fp = fopen(kSnapshotFile, "rb");
+        char buffer[65536];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        {
+            bytes.insert(bytes.end(), buffer, buffer + n);
+        }
+        fclose(fp);
+    }
+    size_t accepted = 0;
+    accepted += CheckRejected(bytes, 0, bytes.size());
+    accepted += CheckRejected(bytes, 8, bytes.size());
+    accepted += CheckRejected(bytes, bytes.size(), bytes.size() - 1);
+    accepted += CheckRejected(bytes, bytes.size(), 16);
+    const size_t misreported = CheckVersionReported(bytes);
+
+    remove(kSnapshotFile);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << kCatalogSize << " models, " << bytes.size() / 1024 << " KB snapshot" << std::endl;
+    std::cout << "text:                  " << text_ms << " ms" << std::endl;
+    std::cout << "snapshot:              " << snapshot_ms << " ms (" << text_ms / snapshot_ms << "x)" << std::endl;
+    std::cout << "snapshot + propagator: " << propagator_ms << " ms" << std::endl;
+    std::cout << "mismatches: " << mismatches << std::endl;
+    std::cout << "record mismatches: " << record_mismatches << std::endl;
+    std::cout << "damaged snapshots accepted: " << accepted << std::endl;
+    std::cout << "versions misreported: " << misreported << std::endl;
+
+    return mismatches == 0 && record_mismatches == 0 && accepted == 0 && misreported == 0 ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file statusbench.cpp
+ * @brief Propagates synthetic catalogs with a growing share of decaying
+ * objects with SGP4::FindPosition(), catching the exceptions it throws, and
+ * with the variant that returns a status instead, checking that every
+ * status matches the exception thrown and reporting the time taken by each.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SGP4.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * base orbits: two that propagate, and two with so much drag that they
+ * decay within hours of epoch
+ */
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 28057U 03049A   06177.78615833  .00000060  00000-0  35940-4 0  1836",
+     "2 28057  98.4283 247.6961 0000884  88.1964 271.9322 14.35478080140550"},
+    {"1 28872U 05037B   05333.02012661  .25992681  00000-0  24476-3 0  1534",
+     "2 28872  96.4736 157.9986 0303955 244.0492 110.6523 16.46015938 10708"},
+    {"1 29141U 85108AA  06170.26783845  .99999999  00000-0  13519-0 0   718",
+     "2 29141  82.4288 273.4882 0015848 277.2124  83.9133 15.93343074  6828"}};
+
+static const size_t kObjects = 10000;
+static const size_t kRepetitions = 3;
+static const double kTimes[] = {480.0, 540.0, 600.0, 660.0};
+static const size_t kTimeCount = sizeof(kTimes) / sizeof(kTimes[0]);
+
+/*
+ * percent of objects generated from the decaying orbits
+ */
+static const unsigned int kDecayingPercent[] = {0, 10, 50};
+
+static std::vector<SGP4> GenerateCatalog(size_t n, unsigned int decaying_percent)
+{
+    std::vector<SGP4> models;
+    models.reserve(n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        const bool decaying = (i * 37) % 100 < decaying_percent;
+        const size_t base = (decaying ? 2 : 0) + i % 2;
+        const unsigned int norad = static_cast<unsigned int>(i % 99999) + 1;
+        const double raan = static_cast<double>((i * 37) % 3600) / 10.0;
+        const double anomaly = static_cast<double>((i * 101) % 3600) / 10.0;
+
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05u%s", norad, kBaseTles[base][0] + 7);
+        snprintf(l2, sizeof(l2), "2 %05u %.8s %8.4f %.17s%8.4f%s",
+                 norad, kBaseTles[base][1] + 8, raan, kBaseTles[base][1] + 26, anomaly, kBaseTles[base][1] + 51);
+
+        models.push_back(SGP4(Tle(l1, l2)));
+    }
+
+    return models;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bool Same(const Vector &a, const Vector &b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+int main()
+{
+    size_t mismatches = 0;
+
+    std::cout << std::setw(9) << "decaying" << std::setw(9) << "failed" << std::setw(14) << "throwing ns"
+              << std::setw(12) << "status ns" << std::setw(10) << "speedup" << std::endl;
+
+    for (size_t d = 0; d < sizeof(kDecayingPercent) / sizeof(kDecayingPercent[0]); d++)
+    {
+        const std::vector<SGP4> models = GenerateCatalog(kObjects, kDecayingPercent[d]);
+        const size_t samples = models.size() * kTimeCount;
+
+        /*
+         * the kind of exception thrown for each sample: 0 none, 1 decayed,
+         * 2 any other
+         */
+        std::vector<Vector> thrown_pos(samples);
+        std::vector<Vector> thrown_vel(samples);
+        std::vector<unsigned char> thrown(samples);
+        std::vector<Vector> pos(samples);
+        std::vector<Vector> vel(samples);
+        std::vector<unsigned char> status(samples);
+
+        double throwing_ms = 1.0e30;
+        double status_ms = 1.0e30;
+        for (size_t r = 0; r < kRepetitions; r++)
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < kTimeCount; t++)
+            {
+                for (size_t i = 0; i < models.size(); i++)
+                {
+                    const size_t k = t * models.size() + i;
+                    try
+                    {
+                        const Eci eci = models[i].FindPosition(kTimes[t]);
+                        thrown_pos[k] = eci.Position();
+                        thrown_vel[k] = eci.Velocity();
+                        thrown[k] = 0;
+                    }
+                    catch (DecayedException &e)
+                    {
+                        thrown_pos[k] = e.Position();
+                        thrown_vel[k] = e.Velocity();
+                        thrown[k] = 1;
+                    }
+                    catch (SatelliteException &)
+                    {
+                        thrown_pos[k] = Vector();
+                        thrown_vel[k] = Vector();
+                        thrown[k] = 2;
+                    }
+                }
+            }
+            throwing_ms = std::min(throwing_ms, ElapsedMs(start));
+
+            start = std::chrono::steady_clock::now();
+            for (size_t t = 0; t < kTimeCount; t++)
+            {
+                for (size_t i = 0; i < models.size(); i++)
+                {
+                    const size_t k = t * models.size() + i;
+                    SGP4::IntegratorParams state;
+                    status[k] = static_cast<unsigned char>(models[i].FindPosition(kTimes[t], state, pos[k], vel[k]));
+                }
+            }
+            status_ms = std::min(status_ms, ElapsedMs(start));
+        }
+
+        size_t failed = 0;
+        for (size_t k = 0; k < samples; k++)
+        {
+            const unsigned char expected = status[k] == SGP4::OK ? 0 : status[k] == SGP4::DECAYED ? 1 : 2;
+            if (expected != thrown[k] || !Same(pos[k], thrown_pos[k]) || !Same(vel[k], thrown_vel[k]))
+            {
+                mismatches++;
+            }
+            if (status[k] != SGP4::OK)
+            {
+                failed++;
+            }
+        }
+
+        /*
+         * the batch form, one object over all the times
+         */
+        for (size_t i = 0; i < models.size(); i++)
+        {
+            Vector batch_pos[kTimeCount];
+            Vector batch_vel[kTimeCount];
+            unsigned char batch_status[kTimeCount];
+            models[i].FindPositions(kTimes, kTimeCount, batch_pos, batch_vel, batch_status);
+            for (size_t t = 0; t < kTimeCount; t++)
+            {
+                const size_t k = t * models.size() + i;
+                if (batch_status[t] != status[k] || !Same(batch_pos[t], pos[k]) || !Same(batch_vel[t], vel[k]))
+                {
+                    mismatches++;
+                }
+            }
+        }
+
+        std::cout << std::setw(8) << kDecayingPercent[d] << "%" << std::fixed << std::setprecision(1)
+                  << std::setw(8) << 100.0 * failed / samples << "%"
+                  << std::setw(14) << throwing_ms * 1.0e6 / samples
+                  << std::setw(12) << status_ms * 1.0e6 / samples
+                  << std::setw(10) << std::setprecision(2) << throwing_ms / status_ms << std::endl;
+    }
+
+    std::cout << "mismatches: " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
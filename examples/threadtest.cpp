@@ -0,0 +1,117 @@
+/**
+ * @file threadtest.cpp
+ * @brief Propagates one shared deep-space SGP4 object from several threads at
+ * once, each over shuffled sample times, and checks every result against a
+ * single-threaded run.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SGP4.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kThreads = 8;
+static const size_t kSamples = 4000;
+
+/*
+ * propagate the samples in the order given, through one integrator state
+ */
+static void Propagate(const SGP4 *sgp4,
+                      const std::vector<size_t> *order,
+                      const std::vector<double> *tsince,
+                      std::vector<Vector> *positions)
+{
+    SGP4::IntegratorParams state;
+
+    for (size_t i = 0; i < order->size(); i++)
+    {
+        const size_t k = (*order)[i];
+
+        /*
+         * alternate between the stateless and the stateful path
+         */
+        if (i % 2 == 0)
+        {
+            (*positions)[k] = sgp4->FindPosition((*tsince)[k]).Position();
+        }
+        else
+        {
+            (*positions)[k] = sgp4->FindPosition((*tsince)[k], state).Position();
+        }
+    }
+}
+
+int main()
+{
+    const Tle tle("GEO",
+                  "1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+                  "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981");
+    const SGP4 sgp4(tle);
+
+    /*
+     * 30 days either side of epoch
+     */
+    std::vector<double> tsince(kSamples);
+    for (size_t i = 0; i < kSamples; i++)
+    {
+        tsince[i] = -43200.0 + 86400.0 * static_cast<double>(i) / (kSamples - 1);
+    }
+
+    std::vector<Vector> reference(kSamples);
+    for (size_t i = 0; i < kSamples; i++)
+    {
+        reference[i] = sgp4.FindPosition(tsince[i]).Position();
+    }
+
+    std::vector<std::vector<size_t> > orders(kThreads, std::vector<size_t>(kSamples));
+    std::vector<std::vector<Vector> > results(kThreads, std::vector<Vector>(kSamples));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kThreads; t++)
+    {
+        for (size_t i = 0; i < kSamples; i++)
+        {
+            orders[t][i] = i;
+        }
+        /*
+         * deterministic shuffle per thread
+         */
+        for (size_t i = kSamples - 1; i > 0; i--)
+        {
+            std::swap(orders[t][i], orders[t][(i * 7919 + t * 104729) % (i + 1)]);
+        }
+
+        threads.push_back(std::thread(Propagate, &sgp4, &orders[t], &tsince, &results[t]));
+    }
+
+    for (size_t t = 0; t < kThreads; t++)
+    {
+        threads[t].join();
+    }
+
+    size_t mismatches = 0;
+    for (size_t t = 0; t < kThreads; t++)
+    {
+        for (size_t i = 0; i < kSamples; i++)
+        {
+            if (results[t][i].x != reference[i].x ||
+                results[t][i].y != reference[i].y ||
+                results[t][i].z != reference[i].z)
+            {
+                mismatches++;
+            }
+        }
+    }
+
+    std::cout << kThreads << " threads x " << kSamples << " samples, mismatches: " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
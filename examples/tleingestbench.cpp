@@ -0,0 +1,143 @@
+/**
+ * @file tleingestbench.cpp
+ * @brief Writes a synthetic archive file mixing two and three line element
+ * sets, line endings and stray lines, and loads it into a TleCatalog on one
+ * thread and across thread pools of several sizes, checking every load
+ * gives the same catalog and reporting the throughput of each.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <TleCatalog.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kArchiveSize = 400000;
+static const char *kArchiveFile = "tleingestbench_archive.tmp";
+
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 29238U 06022G   06177.28732010  .00766286  10823-4  13334-2 0   101",
+     "2 29238  51.5595 213.7903 0202579  95.2503 267.9010 15.73823839  1061"},
+    {"1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656"}};
+
+static bool Same(const TleCatalog &a, const TleCatalog &b)
+{
+    if (a.Size() != b.Size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.Size(); i++)
+    {
+        const TleRecord &x = a.Record(i);
+        const TleRecord &y = b.Record(i);
+        if (x.norad_number != y.norad_number ||
+            strcmp(x.int_designator, y.int_designator) != 0 ||
+            x.epoch != y.epoch ||
+            x.mean_motion_dt2 != y.mean_motion_dt2 ||
+            x.mean_motion_ddt6 != y.mean_motion_ddt6 ||
+            x.bstar != y.bstar ||
+            x.inclination != y.inclination ||
+            x.right_ascending_node != y.right_ascending_node ||
+            x.eccentricity != y.eccentricity ||
+            x.argument_perigee != y.argument_perigee ||
+            x.mean_anomaly != y.mean_anomaly ||
+            x.mean_motion != y.mean_motion ||
+            x.orbit_number != y.orbit_number ||
+            a.Name(i) != b.Name(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    /*
+     * vary the layout pseudo-randomly so chunk boundaries fall on every
+     * kind of line
+     */
+    FILE *fp = fopen(kArchiveFile, "wb");
+    unsigned int seed = 12345;
+    for (size_t i = 0; i < kArchiveSize; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        const unsigned int bits = seed >> 16;
+        const char **base = kBaseTles[i % 3];
+        const char *eol = (bits & 1) ? "\r\n" : "\n";
+
+        if (bits & 2)
+        {
+            fprintf(fp, "%sOBJECT %u%s", (bits & 4) ? "0 " : "", static_cast<unsigned int>(i), eol);
+        }
+        if ((bits & 0x38) == 0)
+        {
+            fprintf(fp, "%s", eol);
+        }
+        fprintf(fp, "1 %05u%.62s%s", static_cast<unsigned int>(i % 99999) + 1, base[0] + 7, eol);
+        if ((bits & 0x1c0) == 0)
+        {
+            /*
+             * a broken element set, missing line two
+             */
+            continue;
+        }
+        fprintf(fp, "2 %05u %8.4f%.53s%s", static_cast<unsigned int>(i % 99999) + 1,
+                static_cast<double>((i * 13) % 1800000) / 10000.0, base[1] + 16, eol);
+    }
+    const double megabytes = static_cast<double>(ftell(fp)) / (1024.0 * 1024.0);
+    fclose(fp);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    TleCatalog reference(kArchiveFile);
+    const double serial_ms = ElapsedMs(start);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << reference.Size() << " element sets, " << megabytes << " MB" << std::endl;
+    std::cout << "serial:     " << serial_ms << " ms (" << megabytes * 1000.0 / serial_ms << " MB/s)" << std::endl;
+
+    size_t mismatches = 0;
+    const size_t threads[] = {1, 2, 4, 8, 16};
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++)
+    {
+        ThreadPool pool(threads[t]);
+
+        start = std::chrono::steady_clock::now();
+        TleCatalog catalog(kArchiveFile, pool);
+        const double parallel_ms = ElapsedMs(start);
+
+        if (!Same(reference, catalog))
+        {
+            mismatches++;
+        }
+
+        std::cout << std::setw(2) << threads[t] << " threads: " << parallel_ms << " ms ("
+                  << megabytes * 1000.0 / parallel_ms << " MB/s, " << serial_ms / parallel_ms << "x)" << std::endl;
+    }
+
+    remove(kArchiveFile);
+
+    std::cout << "mismatches: " << mismatches << std::endl;
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file tleloadbench.cpp
+ * @brief Writes a synthetic catalog file and loads it with TleCatalog, with
+ * ReadTleFromFile, by streaming it through TleReader, and with the line by
+ * line reader ReadTleFromFile used to be, checking they agree and reporting
+ * the time taken by each. Also checks the handling of names, line endings
+ * and stray lines on a small file.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Tle.hpp>
+#include <TleCatalog.hpp>
+#include <TleReader.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kCatalogSize = 200000;
+static const char *kCatalogFile = "tleloadbench_catalog.tmp";
+static const char *kFormatFile = "tleloadbench_format.tmp";
+
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 29238U 06022G   06177.28732010  .00766286  10823-4  13334-2 0   101",
+     "2 29238  51.5595 213.7903 0202579  95.2503 267.9010 15.73823839  1061"},
+    {"1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656"}};
+
+/*
+ * the line by line reader ReadTleFromFile used to be, for comparison
+ */
+static std::vector<Tle> LineByLineRead(const char *fname)
+{
+    size_t m_obj = 1;
+    size_t n_obj = 0;
+
+    FILE *fp = fopen(fname, "r");
+    std::vector<Tle> objs(m_obj);
+    char *res;
+    char l1[128];
+    char l2[128];
+    do
+    {
+        char buf[128];
+        memset(buf, 0x0, sizeof(buf));
+        res = fgets(buf, sizeof(buf), fp);
+        buf[strcspn(buf, "\n")] = '\0';
+        if (strlen(buf) != 69 || buf[0] != '1')
+            continue;
+        if (m_obj <= n_obj)
+        {
+            m_obj++;
+            objs.resize(m_obj);
+        }
+        strncpy(l1, buf, 69);
+        l1[69] = '\0';
+        res = fgets(buf, sizeof(buf), fp);
+        buf[strcspn(buf, "\n")] = '\0';
+        if (strlen(buf) != 69 || buf[0] != '2')
+            continue;
+        strncpy(l2, buf, 69);
+        l2[69] = '\0';
+        objs.at(n_obj).Update(l1, l2);
+        n_obj++;
+    } while (res != NULL);
+    fclose(fp);
+    return objs;
+}
+
+static bool Same(const Tle &tle, const TleRecord &record)
+{
+    return tle.NoradNumber() == record.norad_number &&
+           tle.IntDesignator() == record.int_designator &&
+           tle.Epoch().Ticks() == record.epoch &&
+           tle.MeanMotionDt2() == record.mean_motion_dt2 &&
+           tle.MeanMotionDdt6() == record.mean_motion_ddt6 &&
+           tle.BStar() == record.bstar &&
+           tle.Inclination(true) == record.inclination &&
+           tle.RightAscendingNode(true) == record.right_ascending_node &&
+           tle.Eccentricity() == record.eccentricity &&
+           tle.ArgumentPerigee(true) == record.argument_perigee &&
+           tle.MeanAnomaly(true) == record.mean_anomaly &&
+           tle.MeanMotion() == record.mean_motion &&
+           tle.OrbitNumber() == record.orbit_number;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * a small file mixing two and three line element sets, both line endings,
+ * blank lines and a broken element set
+ */
+static size_t CheckFormats()
+{
+    FILE *fp = fopen(kFormatFile, "wb");
+    fprintf(fp, "ISS (ZARYA)             \n%s\n%s\n", kBaseTles[0][0], kBaseTles[0][1]);
+    fprintf(fp, "%s\r\n%s\r\n", kBaseTles[1][0], kBaseTles[1][1]);
+    fprintf(fp, "\n0 MOLNIYA 2-9\r\n%s\r\n%s\r\n", kBaseTles[2][0], kBaseTles[2][1]);
+    fprintf(fp, "BROKEN\n%s\n\n%s\n", kBaseTles[0][0], kBaseTles[0][1]);
+    fprintf(fp, "%s\n%s\n%s", kBaseTles[0][0], kBaseTles[1][0], kBaseTles[1][1]);
+    fclose(fp);
+
+    const char *expected_names[] = {"ISS (ZARYA)", "29238", "MOLNIYA 2-9", "29238"};
+    const unsigned int expected_numbers[] = {25544, 29238, 8195, 29238};
+    const size_t expected = sizeof(expected_numbers) / sizeof(expected_numbers[0]);
+
+    size_t failures = 0;
+    TleCatalog catalog(kFormatFile);
+    std::vector<Tle> tles = ReadTleFromFile(kFormatFile);
+    if (catalog.Size() != expected || tles.size() != expected)
+    {
+        failures++;
+    }
+    else
+    {
+        for (size_t i = 0; i < expected; i++)
+        {
+            if (catalog.Name(i) != expected_names[i] ||
+                tles[i].Name() != expected_names[i] ||
+                catalog.Record(i).norad_number != expected_numbers[i] ||
+                !Same(tles[i], catalog.Record(i)))
+            {
+                failures++;
+            }
+        }
+    }
+
+    remove(kFormatFile);
+    return failures;
+}
+
+int main()
+{
+    /*
+     * a catalog file in the three line format, varying each element set
+     */
+    FILE *fp = fopen(kCatalogFile, "w");
+    for (size_t i = 0; i < kCatalogSize; i++)
+    {
+        const char **base = kBaseTles[i % 3];
+        fprintf(fp, "OBJECT %-17u\n", static_cast<unsigned int>(i));
+        fprintf(fp, "1 %05u%.62s\n", static_cast<unsigned int>(i % 99999) + 1, base[0] + 7);
+        fprintf(fp, "2 %05u %8.4f%.53s\n", static_cast<unsigned int>(i % 99999) + 1,
+                static_cast<double>((i * 13) % 1800000) / 10000.0, base[1] + 16);
+    }
+    fclose(fp);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<Tle> reference = LineByLineRead(kCatalogFile);
+    const double line_ms = ElapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<Tle> tles = ReadTleFromFile(kCatalogFile);
+    const double read_ms = ElapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    TleCatalog catalog(kCatalogFile);
+    const double catalog_ms = ElapsedMs(start);
+
+    double inclination = 0.0;
+    start = std::chrono::steady_clock::now();
+    const size_t streamed = TleReader::ForEach(kCatalogFile,
+                                               [&inclination](const TleRecord &record, const char *, size_t)
+                                               {
+                                                   inclination += record.inclination;
+                                               });
+    const double stream_ms = ElapsedMs(start);
+
+    remove(kCatalogFile);
+
+    size_t mismatches = 0;
+    if (reference.size() != kCatalogSize || tles.size() != kCatalogSize ||
+        catalog.Size() != kCatalogSize || streamed != kCatalogSize)
+    {
+        mismatches++;
+    }
+    else
+    {
+        char name[32];
+        for (size_t i = 0; i < kCatalogSize; i++)
+        {
+            snprintf(name, sizeof(name), "OBJECT %u", static_cast<unsigned int>(i));
+            if (!Same(reference[i], catalog.Record(i)) || !Same(tles[i], catalog.Record(i)) ||
+                catalog.Name(i) != name || tles[i].Name() != name)
+            {
+                mismatches++;
+            }
+        }
+    }
+
+    const size_t format_failures = CheckFormats();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << kCatalogSize << " element sets" << std::endl;
+    std::cout << "line by line:    " << line_ms << " ms" << std::endl;
+    std::cout << "ReadTleFromFile: " << read_ms << " ms (" << line_ms / read_ms << "x)" << std::endl;
+    std::cout << "TleCatalog:      " << catalog_ms << " ms (" << line_ms / catalog_ms << "x)" << std::endl;
+    std::cout << "streamed:        " << stream_ms << " ms (" << line_ms / stream_ms << "x)" << std::endl;
+    std::cout << "mismatches: " << mismatches << std::endl;
+    std::cout << "format failures: " << format_failures << std::endl;
+
+    return mismatches == 0 && format_failures == 0 ? 0 : 1;
+}
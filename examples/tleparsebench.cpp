@@ -0,0 +1,209 @@
+/**
+ * @file tleparsebench.cpp
+ * @brief Decodes a synthetic catalog of element sets with TleParser and with
+ * the Tle constructor, checking both against strtod on the raw fields and
+ * reporting the time taken by each, then checks malformed fields are
+ * rejected with the messages of the original string-based decoding.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Tle.hpp>
+#include <TleParser.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace LSGP4;
+
+static const size_t kCatalogSize = 25000;
+static const size_t kRepeats = 8;
+
+static const char *kBaseTles[][2] = {
+    {"1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"1 29238U 06022G   06177.28732010  .00766286  10823-4  13334-2 0   101",
+     "2 29238  51.5595 213.7903 0202579  95.2503 267.9010 15.73823839  1061"},
+    {"1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656"},
+    {"1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+     "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981"}};
+
+/*
+ * the field as decimal text, as Tle used to build it for a stringstream
+ */
+static double Reference(const char *line, size_t col, size_t len, bool implied_point)
+{
+    char text[32] = "0.";
+    memcpy(text + (implied_point ? 2 : 0), line + col, len);
+    text[len + (implied_point ? 2 : 0)] = '\0';
+    return strtod(text, NULL);
+}
+
+static double ReferenceExponential(const char *line, size_t col)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "%s0.%.5se%.2s", line[col] == '-' ? "-" : "", line + col + 1, line + col + 6);
+    return strtod(text, NULL);
+}
+
+static bool Check(const std::string &l1, const std::string &l2, const TleRecord &r)
+{
+    const char *a = l1.c_str();
+    const char *b = l2.c_str();
+    return r.mean_motion_dt2 == Reference(a, 33, 10, false) &&
+           r.mean_motion_ddt6 == ReferenceExponential(a, 44) &&
+           r.bstar == ReferenceExponential(a, 53) &&
+           r.inclination == Reference(b, 8, 8, false) &&
+           r.right_ascending_node == Reference(b, 17, 8, false) &&
+           r.eccentricity == Reference(b, 26, 7, true) &&
+           r.argument_perigee == Reference(b, 34, 8, false) &&
+           r.mean_anomaly == Reference(b, 43, 8, false) &&
+           r.mean_motion == Reference(b, 52, 11, false) &&
+           r.norad_number == static_cast<unsigned int>(atoi(std::string(a + 2, 5).c_str()));
+}
+
+/*
+ * a field of the first base element set replaced, and the message the
+ * original string-based decoding rejected it with
+ */
+struct Malformed
+{
+    int line;
+    size_t col;
+    const char *text;
+    const char *message;
+};
+
+static const Malformed kMalformed[] = {
+    {1, 2, "x5544", "Invalid character"},
+    {1, 2, "25x44", "Unexpected non digit"},
+    {1, 20, "337.4973864x", "Invalid digit"},
+    {1, 20, "337,49738641", "Failed to find decimal point"},
+    {1, 53, "*00000+0", "Invalid sign"},
+    {1, 53, " 00000*0", "Invalid exponential sign"},
+    {2, 8, "x51.6389", "Invalid character"},
+    {2, 8, " -1.6389", "Invalid character"},
+    {2, 8, " 5x.6389", "Unexpected non digit"},
+    {2, 8, " 5 .6389", "Unexpected non digit"},
+    {2, 8, " 51,6389", "Failed to find decimal point"},
+    {2, 8, " 51.63x9", "Invalid digit"},
+    {2, 26, "00045x5", "Invalid digit"}};
+
+static size_t CheckMalformed()
+{
+    size_t mismatches = 0;
+    for (size_t i = 0; i < sizeof(kMalformed) / sizeof(kMalformed[0]); i++)
+    {
+        std::string l1 = kBaseTles[0][0];
+        std::string l2 = kBaseTles[0][1];
+        std::string &line = kMalformed[i].line == 1 ? l1 : l2;
+        line.replace(kMalformed[i].col, strlen(kMalformed[i].text), kMalformed[i].text);
+
+        std::string message;
+        try
+        {
+            Tle tle(l1, l2);
+        }
+        catch (TleException &e)
+        {
+            message = e.what();
+        }
+
+        if (message != kMalformed[i].message)
+        {
+            std::cout << "line " << kMalformed[i].line << " \"" << kMalformed[i].text << "\": expected \""
+                      << kMalformed[i].message << "\", got \"" << message << "\"" << std::endl;
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+static double ElapsedMs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    /*
+     * vary every field so no two element sets decode alike
+     */
+    std::vector<std::string> line1;
+    std::vector<std::string> line2;
+    for (size_t i = 0; i < kCatalogSize; i++)
+    {
+        const char **base = kBaseTles[i % 4];
+        char l1[128];
+        char l2[128];
+        snprintf(l1, sizeof(l1), "1 %05u%.11s%02u%03u.%08u%.37s",
+                 static_cast<unsigned int>(i % 99999) + 1, base[0] + 7,
+                 static_cast<unsigned int>(i % 100), static_cast<unsigned int>(i % 365) + 1,
+                 static_cast<unsigned int>((i * 7919) % 100000000), base[0] + 32);
+        snprintf(l2, sizeof(l2), "2 %05u %8.4f %8.4f %07u %8.4f %8.4f %.17s",
+                 static_cast<unsigned int>(i % 99999) + 1,
+                 static_cast<double>((i * 13) % 1800000) / 10000.0,
+                 static_cast<double>((i * 37) % 3600000) / 10000.0,
+                 static_cast<unsigned int>((i * 104729) % 10000000),
+                 static_cast<double>((i * 101) % 3600000) / 10000.0,
+                 static_cast<double>((i * 211) % 3600000) / 10000.0,
+                 base[1] + 52);
+        line1.push_back(l1);
+        line2.push_back(l2);
+    }
+
+    std::vector<TleRecord> records(kCatalogSize);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < kRepeats; r++)
+    {
+        for (size_t i = 0; i < kCatalogSize; i++)
+        {
+            TleParser::Parse(line1[i].data(), line1[i].length(), line2[i].data(), line2[i].length(), records[i]);
+        }
+    }
+    const double parser_ns = ElapsedMs(start) * 1.0e6 / (kRepeats * kCatalogSize);
+
+    std::vector<Tle> tles(kCatalogSize);
+    start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < kRepeats; r++)
+    {
+        for (size_t i = 0; i < kCatalogSize; i++)
+        {
+            tles[i] = Tle(line1[i], line2[i]);
+        }
+    }
+    const double tle_ns = ElapsedMs(start) * 1.0e6 / (kRepeats * kCatalogSize);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < kCatalogSize; i++)
+    {
+        if (!Check(line1[i], line2[i], records[i]) ||
+            tles[i].Epoch().Ticks() != records[i].epoch ||
+            tles[i].BStar() != records[i].bstar ||
+            tles[i].MeanMotion() != records[i].mean_motion)
+        {
+            mismatches++;
+        }
+    }
+
+    const size_t malformed_mismatches = CheckMalformed();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << kCatalogSize << " element sets" << std::endl;
+    std::cout << "Tle:       " << tle_ns << " ns/tle" << std::endl;
+    std::cout << "TleParser: " << parser_ns << " ns/tle (" << tle_ns / parser_ns << "x)" << std::endl;
+    std::cout << "mismatches: " << mismatches << std::endl;
+    std::cout << "malformed message mismatches: " << malformed_mismatches << std::endl;
+
+    return mismatches == 0 && malformed_mismatches == 0 ? 0 : 1;
+}
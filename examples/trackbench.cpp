@@ -0,0 +1,161 @@
+/**
+ * @file trackbench.cpp
+ * @brief Tracks LEO, GPS, Molniya and GEO satellites from one observer at
+ * 10 and 100 Hz with a Tracker, checking every tick against
+ * SGP4::FindPosition() and Observer::GetLookAngle() and reporting the
+ * latency of a tick against the pair of calls it replaces.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <Globals.hpp>
+#include <Observer.hpp>
+#include <Tracker.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * an hour of ticks. positions agree to the 1e-12 radians Kepler's equation
+ * is solved to, and angles to the rounding of DateTime's Julian date in the
+ * sidereal time
+ */
+static const double kTrackSeconds = 3600.0;
+static const double kPositionTolerance = 1.0e-7;
+static const double kAngleTolerance = 1.0e-8;
+
+static const char *kTles[][3] = {
+    {"LEO",
+     "1 25544U 98067A   21337.49738641 -.00000450  00000+0  00000+0 0  9996",
+     "2 25544  51.6389 225.5617 0004535 264.0051 276.0775 15.48792552314838"},
+    {"GPS",
+     "1 28129U 03058A   06175.57071136 -.00000104  00000-0  10000-3 0   459",
+     "2 28129  54.7298 324.8098 0048506 266.2640  93.1663  2.00562768 18443"},
+    {"Molniya",
+     "1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656"},
+    {"GEO",
+     "1 26900U 01039A   06106.74503247  .00000045  00000-0  10000-3 0  8290",
+     "2 26900   0.0164 266.5378 0003319  86.1794 182.2590  1.00273847 16981"}};
+
+static double ElapsedNs(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static double AngleDifference(double a, double b)
+{
+    double d = fmod(fabs(a - b), 2.0 * kPI);
+    return d > kPI ? 2.0 * kPI - d : d;
+}
+
+int main()
+{
+    const CoordGeodetic site(51.5074, -0.1278, 0.05);
+    const int rates[] = {10, 100};
+    size_t failures = 0;
+
+    std::cout << std::left << std::setw(9) << "orbit" << std::right << std::setw(6) << "Hz"
+              << std::setw(9) << "ticks" << std::setw(12) << "max dpos m" << std::setw(13) << "max dang rad"
+              << std::setw(11) << "direct ns" << std::setw(11) << "tick ns" << std::setw(9) << "p50 ns"
+              << std::setw(9) << "p99 ns" << std::setw(10) << "speedup" << std::endl;
+
+    for (size_t s = 0; s < sizeof(kTles) / sizeof(kTles[0]); s++)
+    {
+        const SGP4 sgp4(Tle(kTles[s][0], kTles[s][1], kTles[s][2]));
+        const DateTime start = sgp4.GetTle().Epoch().AddDays(0.5);
+
+        for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+        {
+            const TimeSpan step(static_cast<int64_t>(TicksPerSecond / rates[r]));
+            const size_t ticks = static_cast<size_t>(kTrackSeconds * rates[r]);
+
+            /*
+             * each tick as a full propagation and look angle
+             */
+            Observer observer(site);
+            std::vector<Eci> eci;
+            std::vector<CoordTopocentric> expected;
+            eci.reserve(ticks);
+            expected.reserve(ticks);
+            std::chrono::steady_clock::time_point timer = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < ticks; i++)
+            {
+                const DateTime dt = start.AddTicks(static_cast<int64_t>(i) * step.Ticks());
+                eci.push_back(sgp4.FindPosition(dt));
+                expected.push_back(observer.GetLookAngle(eci.back()));
+            }
+            const double direct_ns = ElapsedNs(timer) / ticks;
+
+            /*
+             * the tracker as a controller would drive it, timing every tick
+             */
+            Tracker tracker(sgp4, site, start, step);
+            std::vector<double> latency(ticks);
+            std::vector<Vector> positions(ticks);
+            std::vector<CoordTopocentric> look_angles(ticks);
+            positions[0] = tracker.Position();
+            look_angles[0] = tracker.LookAngle();
+            latency[0] = 0.0;
+            timer = std::chrono::steady_clock::now();
+            for (size_t i = 1; i < ticks; i++)
+            {
+                const std::chrono::steady_clock::time_point tick = std::chrono::steady_clock::now();
+                tracker.Tick();
+                latency[i] = ElapsedNs(tick);
+                positions[i] = tracker.Position();
+                look_angles[i] = tracker.LookAngle();
+            }
+            const double tick_ns = ElapsedNs(timer) / (ticks - 1);
+
+            if (tracker.Time() != start.AddTicks(static_cast<int64_t>(ticks - 1) * step.Ticks()))
+            {
+                failures++;
+            }
+
+            double max_position = 0.0;
+            double max_angle = 0.0;
+            for (size_t i = 0; i < ticks; i++)
+            {
+                const Vector position = eci[i].Position();
+                const double dx = positions[i].x - position.x;
+                const double dy = positions[i].y - position.y;
+                const double dz = positions[i].z - position.z;
+                max_position = std::max(max_position, sqrt(dx * dx + dy * dy + dz * dz));
+                max_angle = std::max(max_angle,
+                                     AngleDifference(look_angles[i].azimuth, expected[i].azimuth) * cos(expected[i].elevation));
+                max_angle = std::max(max_angle, fabs(look_angles[i].elevation - expected[i].elevation));
+            }
+
+            const bool ok = max_position <= kPositionTolerance && max_angle <= kAngleTolerance;
+            if (!ok)
+            {
+                failures++;
+            }
+
+            std::sort(latency.begin() + 1, latency.end());
+            std::cout << std::left << std::setw(9) << kTles[s][0] << std::right << std::setw(6) << rates[r]
+                      << std::setw(9) << ticks << std::scientific << std::setprecision(2)
+                      << std::setw(12) << max_position * 1000.0 << std::setw(13) << max_angle
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(11) << direct_ns << std::setw(11) << tick_ns
+                      << std::setw(9) << latency[1 + (ticks - 1) / 2]
+                      << std::setw(9) << latency[1 + (ticks - 1) * 99 / 100]
+                      << std::setw(10) << std::setprecision(2) << direct_ns / tick_ns
+                      << (ok ? "" : "  FAILED") << std::endl;
+        }
+    }
+
+    std::cout << "failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,495 @@
+/**
+ * @file verifytest.cpp
+ * @brief Runs the verification set in SGP4-VER.TLE as runtest does,
+ * checking every state vector against the stored reference output in
+ * SGP4-VER.REF and timing each object, and fails when a state vector drifts
+ * beyond the tolerances or, given a timing baseline, when the catalog
+ * propagates more slowly than the baseline allows.
+ *
+ * Options:
+ *   --tle=<file>        the verification set, SGP4-VER.TLE by default
+ *   --reference=<file>  the reference output, SGP4-VER.REF by default
+ *   --record            write the reference output instead of checking it
+ *   --position-tolerance=<km>, --velocity-tolerance=<km/s>
+ *   --timing=<file>     fail if slower than the baseline in the file
+ *   --record-timing=<file>  write the timings as a baseline
+ *   --slowdown=<fraction>   allowed slowdown against the baseline, 0.25 by
+ *                       default
+ *
+ * The reference output has runtest's format, so the output of runtest can
+ * be used as a reference. Timings depend on the machine, so a baseline is
+ * recorded on the machine that checks against it.
+ * @version See Git tags for version information.
+ * @date 2026.10.16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <SGP4.hpp>
+#include <Tle.hpp>
+#include <Util.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace LSGP4;
+
+/*
+ * each object is propagated this many times for its timing, and the median
+ * of this many timings is taken
+ */
+static const size_t kTimingRuns = 50;
+static const size_t kTimingRepetitions = 5;
+
+namespace
+{
+    struct Row
+    {
+        double tsince;
+        double state[6];
+    };
+
+    struct Case
+    {
+        Case(const Tle &tle_, double start_, double end_, double inc_)
+            : tle(tle_), start(start_), end(end_), inc(inc_)
+        {
+        }
+
+        Tle tle;
+        double start;
+        double end;
+        double inc;
+    };
+
+    /*
+     * the samples of one object, as runtest's RunTle(), which stops at the
+     * first error
+     */
+    void RunCase(const SGP4 &model, const Case &test, std::vector<Row> &rows)
+    {
+        rows.clear();
+        double current = test.start;
+        bool running = true;
+        bool first_run = true;
+
+        while (running)
+        {
+            bool error = false;
+            Vector position;
+            Vector velocity;
+            const double tsince = (first_run && current != 0.0) ? 0.0 : current;
+
+            try
+            {
+                const Eci eci = model.FindPosition(tsince);
+                position = eci.Position();
+                velocity = eci.Velocity();
+            }
+            catch (SatelliteException &)
+            {
+                error = true;
+                running = false;
+            }
+            catch (DecayedException &e)
+            {
+                position = e.Position();
+                velocity = e.Velocity();
+                error = !first_run;
+                running = false;
+            }
+
+            if (!error)
+            {
+                Row row;
+                row.tsince = tsince;
+                row.state[0] = position.x;
+                row.state[1] = position.y;
+                row.state[2] = position.z;
+                row.state[3] = velocity.x;
+                row.state[4] = velocity.y;
+                row.state[5] = velocity.z;
+                rows.push_back(row);
+            }
+
+            if ((first_run && current == 0.0) || !first_run)
+            {
+                if (current == test.end)
+                {
+                    running = false;
+                }
+                else if (current + test.inc > test.end)
+                {
+                    current = test.end;
+                }
+                else
+                {
+                    current += test.inc;
+                }
+            }
+            first_run = false;
+        }
+    }
+
+    /*
+     * pairs of lines, the second followed by the start, end and step of
+     * the test in minutes
+     */
+    bool ReadCases(const char *file_name, std::vector<Case> &cases)
+    {
+        std::ifstream file(file_name);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        std::string line;
+        std::string line1;
+        bool got_first_line = false;
+        while (std::getline(file, line))
+        {
+            Util::Trim(line);
+            if (line.length() == 0 || line[0] == '#')
+            {
+                got_first_line = false;
+                continue;
+            }
+
+            if (!got_first_line)
+            {
+                if (line.length() >= Tle::LineLength())
+                {
+                    got_first_line = true;
+                    line1 = line;
+                }
+                continue;
+            }
+
+            got_first_line = false;
+            if (line.length() < Tle::LineLength())
+            {
+                continue;
+            }
+
+            double start = 0.0;
+            double end = 1440.0;
+            double inc = 120.0;
+            std::istringstream parameters(line.substr(Tle::LineLength()));
+            double values[3];
+            if (parameters >> values[0] >> values[1] >> values[2])
+            {
+                start = values[0];
+                end = values[1];
+                inc = values[2];
+            }
+
+            try
+            {
+                cases.push_back(Case(Tle("Test", line1, line.substr(0, Tle::LineLength())), start, end, inc));
+            }
+            catch (TleException &e)
+            {
+                std::cerr << "Error: " << e.what() << std::endl;
+                std::cerr << line << std::endl;
+            }
+        }
+        return true;
+    }
+
+    /*
+     * runtest's output: a line with the catalog number of each object, then
+     * a line per sample
+     */
+    void WriteRows(std::ostream &out, unsigned int norad, const std::vector<Row> &rows)
+    {
+        out << norad << " xx" << std::endl;
+        for (size_t i = 0; i < rows.size(); i++)
+        {
+            out << std::setprecision(8) << std::fixed;
+            out << std::setw(17) << rows[i].tsince << " ";
+            out << std::setw(16) << rows[i].state[0] << " ";
+            out << std::setw(16) << rows[i].state[1] << " ";
+            out << std::setw(16) << rows[i].state[2] << " ";
+            out << std::setprecision(9) << std::fixed;
+            out << std::setw(14) << rows[i].state[3] << " ";
+            out << std::setw(14) << rows[i].state[4] << " ";
+            out << std::setw(14) << rows[i].state[5] << std::endl;
+        }
+    }
+
+    /*
+     * the rows of each object in order, as objects can repeat
+     */
+    bool ReadReference(const char *file_name, std::vector<std::pair<unsigned int, std::vector<Row> > > &reference)
+    {
+        std::ifstream file(file_name);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            if (line.find("xx") != std::string::npos)
+            {
+                reference.push_back(std::make_pair(static_cast<unsigned int>(atoi(line.c_str())), std::vector<Row>()));
+                continue;
+            }
+
+            std::istringstream values(line);
+            Row row;
+            if (!reference.empty() && values >> row.tsince >> row.state[0] >> row.state[1] >> row.state[2] >> row.state[3] >> row.state[4] >> row.state[5])
+            {
+                reference.back().second.push_back(row);
+            }
+        }
+        return true;
+    }
+
+    bool ReadTiming(const char *file_name, std::map<std::string, double> &timing)
+    {
+        std::ifstream file(file_name);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            const std::string::size_type comma = line.find(',');
+            if (comma != std::string::npos && line.compare(0, comma, "object") != 0)
+            {
+                timing[line.substr(0, comma)] = atof(line.c_str() + comma + 1);
+            }
+        }
+        return true;
+    }
+
+    /*
+     * median time of a run of every sample of an object, in nanoseconds
+     */
+    double TimeCase(const SGP4 &model, const Case &test)
+    {
+        std::vector<Row> rows;
+        std::vector<double> times;
+        for (size_t r = 0; r < kTimingRepetitions; r++)
+        {
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < kTimingRuns; i++)
+            {
+                RunCase(model, test, rows);
+            }
+            times.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kTimingRuns);
+        }
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2];
+    }
+
+    const char *Option(const char *argument, const char *name)
+    {
+        const size_t length = strlen(name);
+        return strncmp(argument, name, length) == 0 ? argument + length : NULL;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *tle_file = "SGP4-VER.TLE";
+    const char *reference_file = "SGP4-VER.REF";
+    const char *timing_file = NULL;
+    const char *record_timing_file = NULL;
+    bool record = false;
+    double position_tolerance = 1.0e-6;
+    double velocity_tolerance = 1.0e-8;
+    double slowdown = 0.25;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *value = NULL;
+        if ((value = Option(argv[i], "--tle=")) != NULL)
+        {
+            tle_file = value;
+        }
+        else if ((value = Option(argv[i], "--reference=")) != NULL)
+        {
+            reference_file = value;
+        }
+        else if (strcmp(argv[i], "--record") == 0)
+        {
+            record = true;
+        }
+        else if ((value = Option(argv[i], "--position-tolerance=")) != NULL)
+        {
+            position_tolerance = atof(value);
+        }
+        else if ((value = Option(argv[i], "--velocity-tolerance=")) != NULL)
+        {
+            velocity_tolerance = atof(value);
+        }
+        else if ((value = Option(argv[i], "--timing=")) != NULL)
+        {
+            timing_file = value;
+        }
+        else if ((value = Option(argv[i], "--record-timing=")) != NULL)
+        {
+            record_timing_file = value;
+        }
+        else if ((value = Option(argv[i], "--slowdown=")) != NULL)
+        {
+            slowdown = atof(value);
+        }
+        else
+        {
+            std::cerr << "unknown option " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<Case> cases;
+    if (!ReadCases(tle_file, cases))
+    {
+        std::cerr << "Error opening " << tle_file << std::endl;
+        return 1;
+    }
+
+    if (record)
+    {
+        std::ofstream out(reference_file);
+        std::vector<Row> rows;
+        for (size_t c = 0; c < cases.size(); c++)
+        {
+            RunCase(SGP4(cases[c].tle), cases[c], rows);
+            WriteRows(out, cases[c].tle.NoradNumber(), rows);
+        }
+        std::cout << "recorded " << cases.size() << " objects to " << reference_file << std::endl;
+        return 0;
+    }
+
+    std::vector<std::pair<unsigned int, std::vector<Row> > > reference;
+    if (!ReadReference(reference_file, reference))
+    {
+        std::cerr << "Error opening " << reference_file << std::endl;
+        return 1;
+    }
+
+    std::map<std::string, double> baseline;
+    if (timing_file != NULL && !ReadTiming(timing_file, baseline))
+    {
+        std::cerr << "Error opening " << timing_file << std::endl;
+        return 1;
+    }
+
+    size_t failures = 0;
+    if (reference.size() != cases.size())
+    {
+        std::cout << "reference has " << reference.size() << " objects, " << tle_file << " has "
+                  << cases.size() << std::endl;
+        failures++;
+    }
+
+    std::cout << std::setw(8) << "object" << std::setw(9) << "samples" << std::setw(13) << "max dpos km"
+              << std::setw(15) << "max dvel km/s" << std::setw(14) << "ns/sample" << std::endl;
+
+    std::ostringstream timings;
+    timings << "object,ns_per_sample" << std::endl;
+    size_t total_samples = 0;
+    double total_ns = 0.0;
+    std::vector<Row> rows;
+    for (size_t c = 0; c < cases.size() && c < reference.size(); c++)
+    {
+        const SGP4 model(cases[c].tle);
+        RunCase(model, cases[c], rows);
+
+        const std::vector<Row> &expected = reference[c].second;
+        bool ok = reference[c].first == cases[c].tle.NoradNumber() && rows.size() == expected.size();
+        double max_position = 0.0;
+        double max_velocity = 0.0;
+        for (size_t i = 0; i < rows.size() && i < expected.size(); i++)
+        {
+            double position = 0.0;
+            double velocity = 0.0;
+            for (int k = 0; k < 3; k++)
+            {
+                position += (rows[i].state[k] - expected[i].state[k]) * (rows[i].state[k] - expected[i].state[k]);
+                velocity += (rows[i].state[k + 3] - expected[i].state[k + 3]) * (rows[i].state[k + 3] - expected[i].state[k + 3]);
+            }
+            max_position = std::max(max_position, sqrt(position));
+            max_velocity = std::max(max_velocity, sqrt(velocity));
+            ok = ok && fabs(rows[i].tsince - expected[i].tsince) < 1.0e-6;
+        }
+        ok = ok && max_position <= position_tolerance && max_velocity <= velocity_tolerance;
+
+        const double ns = TimeCase(model, cases[c]);
+        const size_t samples = std::max<size_t>(rows.size(), 1);
+        total_samples += samples;
+        total_ns += ns;
+
+        std::ostringstream name;
+        name << cases[c].tle.NoradNumber() << "/" << c;
+        timings << name.str() << "," << std::fixed << std::setprecision(1) << ns / samples << std::endl;
+
+        std::cout << std::setw(8) << cases[c].tle.NoradNumber() << std::setw(9) << rows.size()
+                  << std::scientific << std::setprecision(2)
+                  << std::setw(13) << max_position << std::setw(15) << max_velocity
+                  << std::fixed << std::setprecision(1) << std::setw(14) << ns / samples
+                  << (ok ? "" : "  FAILED") << std::endl;
+        if (!ok)
+        {
+            failures++;
+        }
+    }
+
+    const double ns_per_sample = total_ns / total_samples;
+    timings << "total," << std::fixed << std::setprecision(1) << ns_per_sample << std::endl;
+    std::cout << cases.size() << " objects, " << total_samples << " samples, "
+              << std::fixed << std::setprecision(1) << ns_per_sample << " ns/sample, "
+              << std::setprecision(0) << 1.0e9 / ns_per_sample << " samples/s" << std::endl;
+
+    /*
+     * the whole set against the baseline, as single objects are too short
+     * to time reliably
+     */
+    if (timing_file != NULL)
+    {
+        const std::map<std::string, double>::const_iterator total = baseline.find("total");
+        if (total == baseline.end())
+        {
+            std::cout << timing_file << " has no total" << std::endl;
+            failures++;
+        }
+        else
+        {
+            const double ratio = ns_per_sample / total->second;
+            std::cout << "against baseline " << std::setprecision(1) << total->second << " ns/sample: "
+                      << std::setprecision(2) << ratio << "x" << std::endl;
+            if (ratio > 1.0 + slowdown)
+            {
+                std::cout << "slower than the baseline by more than " << slowdown * 100.0 << "%" << std::endl;
+                failures++;
+            }
+        }
+    }
+
+    if (record_timing_file != NULL)
+    {
+        std::ofstream out(record_timing_file);
+        out << timings.str();
+    }
+
+    std::cout << "failures: " << failures << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
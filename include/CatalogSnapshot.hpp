@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CATALOGSNAPSHOT_H_
+#define CATALOGSNAPSHOT_H_
+
+#include "MappedFile.hpp"
+#include "SGP4.hpp"
+#include "TleParser.hpp"
+
+#include <stdint.h>
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief A binary snapshot of initialised SGP4 models, mapped into memory.
+     *
+     * The file holds a header followed by one fixed size entry per model:
+     * the decoded element set, the OrbitalElements derived from it and the
+     * constants SGP4::Initialise() computed, exactly as held in memory. A
+     * model is restored by copying its entry, with no parsing and no
+     * initialisation, and propagates identically to the model written.
+     *
+     * Entries are laid out as in memory, so a snapshot is read back only by a
+     * build with the same byte order and structure layout; the header records
+     * both, along with a format version, and anything else is rejected.
+     * Names and the text of the element sets are not kept.
+     */
+    class CatalogSnapshot
+    {
+    public:
+        /**
+         * @param[in] fname the snapshot file
+         * @throws std::invalid_argument if the file cannot be opened, is not
+         * a snapshot, or was written by an incompatible version or build
+         */
+        explicit CatalogSnapshot(const char *fname);
+
+        /**
+         * @returns the number of models
+         */
+        size_t Size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @param[in] i the index of the model
+         * @returns the element set the model was initialised from
+         */
+        const TleRecord &Record(size_t i) const;
+
+        /**
+         * @param[in] i the index of the model
+         * @returns the model, ready to propagate
+         */
+        SGP4 Satellite(size_t i) const;
+
+        /**
+         * @returns every model, in snapshot order
+         */
+        std::vector<SGP4> Satellites() const;
+
+        /**
+         * @brief Write a snapshot of initialised models
+         *
+         * @param[in] fname the file to write
+         * @param[in] satellites the models
+         * @throws std::invalid_argument if the file cannot be written
+         */
+        static void Write(const char *fname, const std::vector<SGP4> &satellites);
+
+        /**
+         * @returns the format version written and accepted
+         */
+        static uint32_t Version()
+        {
+            return 1;
+        }
+
+    private:
+        CatalogSnapshot(const CatalogSnapshot &);
+        CatalogSnapshot &operator=(const CatalogSnapshot &);
+
+        struct Header;
+        struct Entry;
+
+        const Entry &GetEntry(size_t i) const;
+
+        MappedFile file_;
+        size_t size_;
+    };
+};
+
+#endif
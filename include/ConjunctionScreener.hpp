@@ -0,0 +1,191 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CONJUNCTIONSCREENER_H_
+#define CONJUNCTIONSCREENER_H_
+
+#include "DateTime.hpp"
+#include "SGP4.hpp"
+#include "SatelliteCatalogPropagator.hpp"
+#include "ThreadPool.hpp"
+#include "TimeSpan.hpp"
+
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief A close approach between two objects.
+     */
+    struct Conjunction
+    {
+        /** index of the primary object */
+        size_t primary;
+        /** index of the secondary object */
+        size_t secondary;
+        /** time of closest approach */
+        DateTime tca;
+        /** distance at closest approach in kilometers */
+        double miss_distance;
+        /** relative speed at closest approach in kilometers per second */
+        double relative_speed;
+    };
+
+    /**
+     * @brief Finds the close approaches between the objects of two catalogs,
+     * or between the objects of one.
+     *
+     * The search is cut into windows of one time step. At the middle of each
+     * window every object is propagated with a SatelliteCatalogPropagator
+     * and the positions hashed into a uniform grid, with cells as large as
+     * the distance two objects could close within half a window. Only
+     * objects in neighbouring cells are compared, and only if their
+     * perigee to apogee shells overlap. A pair whose straight line motion
+     * brings it within the threshold, allowing for the curvature of the
+     * orbits, has its time of closest approach found by root finding on the
+     * range rate within the window, and is reported if its miss distance
+     * there is within the threshold.
+     *
+     * Each window reports the approaches whose time of closest approach falls
+     * within it, one per pair: a pair whose range rate changes sign more than
+     * once in a window reports one of its minima. Objects whose shells
+     * overlap no shell of the other catalog, found with a ShellIndex, are
+     * never propagated. Two entries with the same NORAD number are taken to
+     * be the same object and never compared. The screener keeps its own
+     * copies of the objects, with integrator checkpoints enabled, so a
+     * screening far from epoch costs no more than one near it.
+     */
+    class ConjunctionScreener
+    {
+    public:
+        /**
+         * @param[in] primaries the objects to screen, such as a fleet
+         * @param[in] secondaries the objects to screen them against, such as
+         * the whole catalog
+         * @param[in] threshold the miss distance in kilometers at or below
+         * which an approach is reported
+         */
+        ConjunctionScreener(const std::vector<SGP4> &primaries,
+                            const std::vector<SGP4> &secondaries,
+                            double threshold = 5.0);
+
+        /**
+         * @brief Screen every pair of objects of one catalog
+         *
+         * Conjunctions index the catalog, with primary < secondary.
+         * @param[in] catalog the objects
+         * @param[in] threshold the miss distance in kilometers at or below
+         * which an approach is reported
+         */
+        explicit ConjunctionScreener(const std::vector<SGP4> &catalog,
+                                     double threshold = 5.0);
+
+        /**
+         * Set the length of the windows the search is cut into. Defaults to
+         * one minute. Shorter steps propagate more often but compare fewer
+         * pairs.
+         * @param[in] step the time step
+         */
+        void SetTimeStep(const TimeSpan &step);
+
+        /**
+         * Set the accuracy of the time of closest approach. Defaults to 1 ms.
+         * @param[in] tolerance the accuracy
+         */
+        void SetTolerance(const TimeSpan &tolerance);
+
+        /**
+         * @brief Find every close approach between two times
+         *
+         * Objects are skipped wherever they fail to propagate.
+         * @param[in] start the start of the search
+         * @param[in] end the end of the search
+         * @returns the conjunctions, ordered by time of closest approach, then
+         * primary, then secondary
+         */
+        std::vector<Conjunction> FindConjunctions(const DateTime &start,
+                                                  const DateTime &end) const;
+
+        /**
+         * @brief Find every close approach between two times, screening
+         * several windows at once over a thread pool
+         *
+         * The result is the same as FindConjunctions(const DateTime &, const DateTime &).
+         * @param[in] start the start of the search
+         * @param[in] end the end of the search
+         * @param[in] pool the threads to use
+         * @returns the conjunctions, ordered by time of closest approach, then
+         * primary, then secondary
+         */
+        std::vector<Conjunction> FindConjunctions(const DateTime &start,
+                                                  const DateTime &end,
+                                                  ThreadPool &pool) const;
+
+    private:
+        ConjunctionScreener(const ConjunctionScreener &);
+        ConjunctionScreener &operator=(const ConjunctionScreener &);
+
+        struct Window;
+        class CellGrid;
+
+        std::vector<SGP4> Select(const std::vector<SGP4> &primaries,
+                                 const std::vector<SGP4> &secondaries);
+        std::vector<Conjunction> Screen(const DateTime &start,
+                                        const DateTime &end,
+                                        ThreadPool *pool) const;
+        void ScreenWindow(const Window &window,
+                          const Vector *positions,
+                          const Vector *velocities,
+                          const bool *valid,
+                          size_t stride,
+                          std::vector<Conjunction> &conjunctions) const;
+        bool Refine(size_t a,
+                    size_t b,
+                    const Window &window,
+                    Conjunction &conjunction) const;
+        bool RelativeState(size_t a,
+                           size_t b,
+                           const Window &window,
+                           double seconds,
+                           Vector &position,
+                           Vector &velocity) const;
+
+        double threshold_;
+        bool self_;
+
+        /*
+         * the objects propagated: the primaries, then the secondaries, less
+         * those the shells rule out. indices_ maps them back to the catalogs
+         * given, with their perigee and apogee radii in kilometers and NORAD
+         * numbers alongside. in self screening every object is a primary
+         */
+        size_t primary_count_;
+        std::vector<size_t> indices_;
+        std::vector<double> perigees_;
+        std::vector<double> apogees_;
+        std::vector<unsigned int> norad_numbers_;
+        std::vector<SGP4> satellites_;
+        SatelliteCatalogPropagator propagator_;
+
+        /*
+         * time step and tolerance in seconds
+         */
+        double step_;
+        double tolerance_;
+    };
+};
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COORDINATEKERNEL_H_
+#define COORDINATEKERNEL_H_
+
+#include "CoordGeodetic.hpp"
+#include "CoordTopocentric.hpp"
+#include "NearSpaceKernel.hpp"
+#include "Vector.hpp"
+
+#include <cstddef>
+
+namespace LSGP4
+{
+    /**
+     * @brief Coordinate conversions over many points at once.
+     * Points are passed as separate arrays of each coordinate. The vector
+     * implementations run lane-wise over 4 or 8 points with the polynomial
+     * elementary functions of NearSpaceKernel, and are selected the same
+     * way, from NearSpaceKernel::Isa.
+     */
+    class CoordinateKernel
+    {
+    public:
+        /**
+         * @brief An observer at one time, with the sines and cosines of the
+         * rotation to its horizon computed once for every look angle.
+         * SetLocation() fills in the parts that do not change with time, and
+         * SetSiderealTime() the rest.
+         */
+        struct Station
+        {
+            /** Eci position in kilometers */
+            double position[3];
+            /** Eci velocity in kilometers per second */
+            double velocity[3];
+            /** geodetic latitude */
+            double sin_lat;
+            double cos_lat;
+            /** local mean sidereal time */
+            double sin_theta;
+            double cos_theta;
+            /**
+             * distance from the Earth's axis and height above the equator
+             * in kilometers
+             */
+            double axis_distance;
+            double height;
+        };
+
+        /**
+         * Set the time invariant part of an observer, taking into account
+         * the flattening of the Earth as Eci::ToEci()
+         * @param[in] geo the observers position
+         * @param[out] station the observer, whose time is left unset
+         */
+        static void SetLocation(const CoordGeodetic &geo, Station &station);
+
+        /**
+         * Turn an observer set by SetLocation() with the Earth to a time
+         * @param[in] theta the local mean sidereal time of the observer in
+         * radians
+         * @param[in,out] station the observer
+         */
+        static void SetSiderealTime(double theta, Station &station);
+
+        /**
+         * Look angle from an observer to one object at the observer's time,
+         * as Observer::GetLookAngle()
+         * @param[in] station the observer
+         * @param[in] position the object's position in kilometers
+         * @param[in] velocity the object's velocity in kilometers per second
+         * @returns the look angle
+         */
+        static CoordTopocentric GetLookAngle(const Station &station,
+                                             const Vector &position,
+                                             const Vector &velocity);
+
+        /**
+         * Convert Eci positions at one time to geodetic coordinates.
+         * Latitude is found by two fixed steps of Bowring's method, with no
+         * data dependent iteration: the result is within a micrometre of
+         * the exact conversion from the surface out to beyond geostationary
+         * altitude, where Eci::ToGeodetic() stops at 1e-10 radians. The
+         * altitude is taken along the normal, so it holds at the poles too.
+         * @param[in] isa the implementation, which must be supported
+         * @param[in] gmst the Greenwich mean sidereal time in radians
+         * @param[in] x array of n x coordinates in kilometers
+         * @param[in] y array of n y coordinates in kilometers
+         * @param[in] z array of n z coordinates in kilometers
+         * @param[in] n number of points
+         * @param[out] latitude array of n latitudes in radians
+         * @param[out] longitude array of n longitudes in radians, in
+         * [-pi, pi]
+         * @param[out] altitude array of n altitudes in kilometers
+         */
+        static void ToGeodetic(NearSpaceKernel::Isa isa,
+                               double gmst,
+                               const double *x,
+                               const double *y,
+                               const double *z,
+                               size_t n,
+                               double *latitude,
+                               double *longitude,
+                               double *altitude);
+
+        /**
+         * Look angles from an observer to many objects at the observer's
+         * time, as Observer::GetLookAngle(). Elevation is found from the
+         * arctangent of the horizon components rather than the arcsine of
+         * their ratio to the range, which agrees to within rounding.
+         * @param[in] isa the implementation, which must be supported
+         * @param[in] station the observer
+         * @param[in] x array of n x coordinates in kilometers
+         * @param[in] y array of n y coordinates in kilometers
+         * @param[in] z array of n z coordinates in kilometers
+         * @param[in] vx array of n x velocities in kilometers per second
+         * @param[in] vy array of n y velocities in kilometers per second
+         * @param[in] vz array of n z velocities in kilometers per second
+         * @param[in] n number of objects
+         * @param[out] azimuth array of n azimuths in radians, in [0, 2pi)
+         * @param[out] elevation array of n elevations in radians
+         * @param[out] range array of n ranges in kilometers
+         * @param[out] range_rate array of n range rates in kilometers per
+         * second
+         */
+        static void GetLookAngles(NearSpaceKernel::Isa isa,
+                                  const Station &station,
+                                  const double *x,
+                                  const double *y,
+                                  const double *z,
+                                  const double *vx,
+                                  const double *vy,
+                                  const double *vz,
+                                  size_t n,
+                                  double *azimuth,
+                                  double *elevation,
+                                  double *range,
+                                  double *range_rate);
+    };
+};
+
+#endif
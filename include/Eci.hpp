@@ -129,6 +129,16 @@ namespace LSGP4
          */
         CoordGeodetic ToGeodetic() const;
 
+        /**
+         * Convert many positions to geodetic form at once, with the
+         * vectorised CoordinateKernel::ToGeodetic(). The sidereal time is
+         * computed once for each run of positions with the same date.
+         * @param[in] eci array of n positions
+         * @param[in] n number of positions
+         * @param[out] geodetic array of n positions in geodetic form
+         */
+        static void ToGeodetic(const Eci *eci, size_t n, CoordGeodetic *geodetic);
+
     private:
         void ToEci(const DateTime &dt, const CoordGeodetic &geo);
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef EPHEMERISINTERPOLATOR_H_
+#define EPHEMERISINTERPOLATOR_H_
+
+#include "DateTime.hpp"
+#include "Eci.hpp"
+#include "SGP4.hpp"
+#include "Vector.hpp"
+
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief Dense ephemeris of one satellite over a span, interpolated from
+     * SGP4.
+     *
+     * The span is cut into segments, each fitted from SGP4 positions and
+     * velocities, either as a cubic Hermite polynomial between the states at
+     * its two ends or as Chebyshev series through the states at Chebyshev
+     * nodes. Hermite velocities are corrected, from the SGP4 velocity at the
+     * middle of the segment, for SGP4 velocities not being exactly the rate
+     * of change of its positions.
+     *
+     * A segment is halved until the fit agrees with SGP4 in both position
+     * and velocity to within nine tenths of the tolerances at the points
+     * that bracket where its error peaks: every eighth of a Hermite segment,
+     * and the extrema of the next Chebyshev polynomial once the last terms
+     * of the series are below the tolerances. The error is smooth between
+     * those points, and the tenth left over covers it, so the tolerances
+     * hold over the whole span. The one exception is a segment that would be
+     * halved below a second, which is kept as it is.
+     *
+     * A query finds its segment from the bin of the span it falls in, with
+     * a few comparisons, and evaluates one polynomial. ephemerisbench
+     * measures about 35 to 55 ns a Hermite query and 70 to 80 ns a
+     * Chebyshev query, most of it the twelve terms of each series, against
+     * 400 to 900 ns for SGP4 on the same machine.
+     *
+     * Queries do not modify the object, so any number of threads can share
+     * one.
+     */
+    class EphemerisInterpolator
+    {
+    public:
+        enum Method
+        {
+            /** cubic Hermite between consecutive SGP4 states */
+            HERMITE,
+            /** Chebyshev series through SGP4 states at Chebyshev nodes */
+            CHEBYSHEV
+        };
+
+        /**
+         * @param[in] sgp4 the satellite
+         * @param[in] start the start of the span
+         * @param[in] end the end of the span
+         * @param[in] tolerance the position error allowed in kilometers
+         * @param[in] method the interpolation method
+         * @param[in] velocity_tolerance the velocity error allowed in
+         * kilometers per second
+         * @throws SatelliteException if the satellite cannot be propagated
+         * over the whole span
+         */
+        EphemerisInterpolator(const SGP4 &sgp4,
+                              const DateTime &start,
+                              const DateTime &end,
+                              double tolerance = 1.0e-3,
+                              Method method = CHEBYSHEV,
+                              double velocity_tolerance = 1.0e-4);
+
+        /**
+         * @returns the start of the span
+         */
+        DateTime Start() const
+        {
+            return start_;
+        }
+
+        /**
+         * @returns the end of the span
+         */
+        DateTime End() const
+        {
+            return end_;
+        }
+
+        /**
+         * @returns the number of segments
+         */
+        size_t SegmentCount() const
+        {
+            return bounds_.size() - 1;
+        }
+
+        /**
+         * @returns the number of SGP4 evaluations made to build the fit,
+         * including those used to check it
+         */
+        size_t EvaluationCount() const
+        {
+            return evaluations_;
+        }
+
+        /**
+         * @brief Find the position and velocity of the satellite
+         *
+         * @param[in] dt the time, within the span
+         * @returns the position and velocity
+         * @throws std::out_of_range if the time is outside the span
+         */
+        Eci FindPosition(const DateTime &dt) const;
+
+        /**
+         * @brief Find the position and velocity of the satellite
+         *
+         * @param[in] tsince time since epoch in minutes, within the span
+         * @param[out] position the position in kilometers
+         * @param[out] velocity the velocity in kilometers per second
+         * @throws std::out_of_range if the time is outside the span
+         */
+        void FindPosition(double tsince, Vector &position, Vector &velocity) const;
+
+    private:
+        void Sample(const SGP4 &sgp4, double tsince, double *state);
+        void RefineHermite(const SGP4 &sgp4,
+                           double first,
+                           const double *first_state,
+                           double last,
+                           const double *last_state);
+        void RefineChebyshev(const SGP4 &sgp4, double first, double last);
+        size_t FindSegment(double tsince) const;
+
+        DateTime epoch_;
+        DateTime start_;
+        DateTime end_;
+        double tolerance_;
+        double velocity_tolerance_;
+        Method method_;
+        size_t evaluations_;
+
+        /*
+         * the resonance integrator state, continued from one sample to the
+         * next while the fit is built
+         */
+        SGP4::IntegratorParams integ_params_;
+
+        /*
+         * segment boundaries in minutes since epoch. segment i covers
+         * [bounds_[i], bounds_[i + 1]]
+         */
+        std::vector<double> bounds_;
+
+        /*
+         * the span cut into SegmentCount() equal bins. bins_[b] is the
+         * segment holding the start of bin b, and bins_[b + 1] the segment
+         * holding its end, so a query searches only the segments between
+         */
+        double bin_scale_;
+        std::vector<size_t> bins_;
+
+        /*
+         * HERMITE: position (km) and velocity (km/min) at each boundary, six
+         * values per boundary. CHEBYSHEV: per segment, the series of the
+         * position and velocity (km/s) coordinates, term by term with six
+         * coefficients per term
+         */
+        std::vector<double> data_;
+
+        /*
+         * HERMITE: per segment, the velocity correction at the middle
+         * (km/min), applied as 4s(1 - s) at fraction s of the segment
+         */
+        std::vector<double> corrections_;
+    };
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <cstddef>
+
+namespace LSGP4
+{
+    /**
+     * @brief A file mapped read only into memory.
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * @param[in] fname the file name
+         * @throws std::invalid_argument if the file cannot be opened
+         */
+        explicit MappedFile(const char *fname);
+        ~MappedFile();
+
+        /**
+         * @returns the contents of the file, NULL if it is empty
+         */
+        const char *Data() const
+        {
+            return data_;
+        }
+
+        /**
+         * @returns the size of the file in bytes
+         */
+        size_t Size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Hint that the file will be read from start to end
+         */
+        void AdviseSequential() const;
+
+        /**
+         * @brief Hand the whole pages within [begin, end) back to the system.
+         * They are read from the file again if touched.
+         *
+         * @param[in] begin the start of the range in bytes
+         * @param[in] end the end of the range in bytes
+         * @returns the offset released up to, or begin if no whole page lies
+         * within the range
+         */
+        size_t Release(size_t begin, size_t end) const;
+
+    private:
+        MappedFile(const MappedFile &);
+        MappedFile &operator=(const MappedFile &);
+
+        const char *data_;
+        size_t size_;
+#ifdef _WIN32
+        void *file_;
+        void *mapping_;
+#endif
+    };
+};
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NEARSPACEKERNEL_H_
+#define NEARSPACEKERNEL_H_
+
+#include "Vector.hpp"
+
+#include <cstddef>
+
+namespace LSGP4
+{
+    class SGP4;
+
+    /**
+     * @brief Near-space SGP4 propagation over many objects at once.
+     *
+     * The model inputs of each object are stored column-wise: field f of
+     * object i lives at consts[f * stride + i]. The vector implementations
+     * run the SGP4::FindPositionSGP4() arithmetic lane-wise over a block of
+     * objects, with polynomial sin/cos/atan2 and a masked Kepler iteration,
+     * and are selected at runtime from the instruction sets the CPU supports.
+     * They agree with the scalar model to well below a millimetre; SCALAR
+     * reproduces SGP4::FindPosition() exactly.
+     *
+     * Objects per block, Propagate() / PropagateFloat():
+     * - SCALAR: 1 / 1
+     * - SSE2: 4 / 8, each block held in two 128-bit registers
+     * - AVX2: 4 / 8
+     * - AVX512: 8 / 16
+     */
+    class NearSpaceKernel
+    {
+    public:
+        /**
+         * Model inputs, in column order
+         */
+        enum Field
+        {
+            XMO,
+            OMEGAO,
+            XNODEO,
+            XINCL,
+            EO,
+            BSTAR,
+            AODP,
+            XNODP,
+            COSIO,
+            SINIO,
+            ETA,
+            T2COF,
+            X1MTH2,
+            X3THM1,
+            X7THM1,
+            AYCOF,
+            XLCOF,
+            XNODCF,
+            C1,
+            C4,
+            OMGDOT,
+            XNODOT,
+            XMDOT,
+            C5,
+            OMGCOF,
+            XMCOF,
+            DELMO,
+            SINMO,
+            D2,
+            D3,
+            D4,
+            T3COF,
+            T4COF,
+            T5COF,
+            FIELD_COUNT
+        };
+
+        /**
+         * Kernel implementations
+         */
+        enum Isa
+        {
+            SCALAR,
+            SSE2,
+            AVX2,
+            AVX512
+        };
+
+        /**
+         * @returns the fastest implementation the CPU supports
+         */
+        static Isa BestIsa();
+
+        /**
+         * @param[in] isa the implementation
+         * @returns whether the CPU supports the implementation
+         */
+        static bool IsSupported(Isa isa);
+
+        /**
+         * @param[in] isa the implementation
+         * @returns the name of the implementation
+         */
+        static const char *IsaName(Isa isa);
+
+        /**
+         * Store the model inputs of a near-space SGP4 model as column slot
+         * @param[in] sgp4 an SGP4 model that does not use the deep space model
+         * @param[out] consts the columns
+         * @param[in] stride the length of each column
+         * @param[in] slot the entry to write in each column
+         */
+        static void Pack(const SGP4 &sgp4, double *consts, size_t stride, size_t slot);
+
+        /**
+         * Propagate n objects, each by its own time since epoch.
+         *
+         * Results for object i are written to entry index[i] of the output
+         * arrays, or entry i if index is NULL. Objects with an error status
+         * other than DECAYED report zero vectors.
+         *
+         * @param[in] isa the implementation, which must be supported
+         * @param[in] consts the model inputs, as written by Pack()
+         * @param[in] stride the length of each column
+         * @param[in] tsince array of n times since epoch in minutes
+         * @param[in] n number of objects
+         * @param[in] index optional array of n output entries
+         * @param[out] positions positions in kilometers
+         * @param[out] velocities velocities in kilometers per second
+         * @param[out] status SGP4::Status of each object
+         */
+        static void Propagate(Isa isa,
+                              const double *consts,
+                              size_t stride,
+                              const double *tsince,
+                              size_t n,
+                              const size_t *index,
+                              Vector *positions,
+                              Vector *velocities,
+                              unsigned char *status);
+
+        /**
+         * Propagate n objects, each by its own time since epoch, in single
+         * precision.
+         *
+         * As Propagate(), from the same model inputs, for uses such as
+         * display and coarse screening that do not need double precision.
+         * The vector implementations run twice as many objects per
+         * instruction. The secular angles are advanced in double and reduced
+         * before the rest of the model runs in float, so the error stays
+         * near the resolution of a float rather than growing with the time
+         * since epoch. Against the scalar model one to seven days from
+         * epoch, floatbench measures a median position error of about 1.3 m
+         * each day, 99% of errors below 7 m and none above 15 m, and
+         * velocity errors below 16 mm/s. Objects at the point of decay may
+         * be reported DECAYED a moment earlier or later than by Propagate().
+         *
+         * @param[in] isa the implementation, which must be supported
+         * @param[in] consts the model inputs, as written by Pack()
+         * @param[in] stride the length of each column
+         * @param[in] tsince array of n times since epoch in minutes
+         * @param[in] n number of objects
+         * @param[in] index optional array of n output entries
+         * @param[out] positions positions in kilometers
+         * @param[out] velocities velocities in kilometers per second
+         * @param[out] status SGP4::Status of each object
+         */
+        static void PropagateFloat(Isa isa,
+                                   const double *consts,
+                                   size_t stride,
+                                   const double *tsince,
+                                   size_t n,
+                                   const size_t *index,
+                                   Vector *positions,
+                                   Vector *velocities,
+                                   unsigned char *status);
+
+    private:
+        static void PropagateScalar(const double *consts,
+                                    size_t stride,
+                                    const double *tsince,
+                                    size_t n,
+                                    const size_t *index,
+                                    Vector *positions,
+                                    Vector *velocities,
+                                    unsigned char *status);
+    };
+};
+
+#endif
@@ -18,6 +18,7 @@
 #define OBSERVER_H_
 
 #include "CoordGeodetic.hpp"
+#include "CoordinateKernel.hpp"
 #include "Eci.hpp"
 
 class DateTime;
@@ -26,7 +27,8 @@ namespace LSGP4
 {
     struct CoordTopocentric;
     /**
-     * @brief Stores an observers location in Eci coordinates.
+     * @brief Stores an observers location, and its Eci position at the
+     * time of the last look angle.
      */
     class Observer
     {
@@ -40,8 +42,9 @@ namespace LSGP4
         Observer(const double latitude,
                  const double longitude,
                  const double altitude)
-            : m_geo(latitude, longitude, altitude), m_eci(DateTime(), m_geo)
+            : m_geo(latitude, longitude, altitude)
         {
+            Locate();
         }
 
         /**
@@ -49,8 +52,9 @@ namespace LSGP4
          * @param[in] geo the observers position
          */
         Observer(const CoordGeodetic &geo)
-            : m_geo(geo), m_eci(DateTime(), geo)
+            : m_geo(geo)
         {
+            Locate();
         }
 
         /**
@@ -60,7 +64,7 @@ namespace LSGP4
         void SetLocation(const CoordGeodetic &geo)
         {
             m_geo = geo;
-            m_eci.Update(m_eci.GetDateTime(), m_geo);
+            Locate();
         }
 
         /**
@@ -79,22 +83,64 @@ namespace LSGP4
          */
         CoordTopocentric GetLookAngle(const Eci &eci);
 
+        /**
+         * Get the look angles from the observers position to many objects at
+         * one time, with the vectorised CoordinateKernel::GetLookAngles()
+         * @param[in] dt the time of every object
+         * @param[in] x array of n x coordinates in kilometers
+         * @param[in] y array of n y coordinates in kilometers
+         * @param[in] z array of n z coordinates in kilometers
+         * @param[in] vx array of n x velocities in kilometers per second
+         * @param[in] vy array of n y velocities in kilometers per second
+         * @param[in] vz array of n z velocities in kilometers per second
+         * @param[in] n number of objects
+         * @param[out] azimuth array of n azimuths in radians
+         * @param[out] elevation array of n elevations in radians
+         * @param[out] range array of n ranges in kilometers
+         * @param[out] range_rate array of n range rates in kilometers per
+         * second
+         */
+        void GetLookAngles(const DateTime &dt,
+                           const double *x,
+                           const double *y,
+                           const double *z,
+                           const double *vx,
+                           const double *vy,
+                           const double *vz,
+                           size_t n,
+                           double *azimuth,
+                           double *elevation,
+                           double *range,
+                           double *range_rate);
+
     private:
+        /**
+         * Place the observer at its location, at the current time
+         */
+        void Locate()
+        {
+            CoordinateKernel::SetLocation(m_geo, m_station);
+            CoordinateKernel::SetSiderealTime(m_dt.ToLocalMeanSiderealTime(m_geo.longitude), m_station);
+        }
+
         /**
          * @param[in] dt the date to update the observers position for
          */
         void Update(const DateTime &dt)
         {
-            if (m_eci != dt)
+            if (m_dt != dt)
             {
-                m_eci.Update(dt, m_geo);
+                m_dt = dt;
+                CoordinateKernel::SetSiderealTime(m_dt.ToLocalMeanSiderealTime(m_geo.longitude), m_station);
             }
         }
 
         /** the observers position */
         CoordGeodetic m_geo;
-        /** the observers Eci for a particular time */
-        Eci m_eci;
+        /** the time of the observers Eci position */
+        DateTime m_dt;
+        /** the observer at that time */
+        CoordinateKernel::Station m_station;
     };
 };
 #endif
@@ -19,9 +19,11 @@
 
 #include "Util.hpp"
 #include "DateTime.hpp"
+#include "TleParser.hpp"
 
 namespace LSGP4
 {
+    class CatalogSnapshot;
     class Tle;
     /**
      * @brief The extracted orbital elements used by the SGP4 propagator.
@@ -30,6 +32,7 @@ namespace LSGP4
     {
     public:
         OrbitalElements(const Tle &tle);
+        explicit OrbitalElements(const TleRecord &record);
 
         /*
          * XMO
@@ -128,6 +131,12 @@ namespace LSGP4
         }
 
     private:
+        friend class CatalogSnapshot;
+
+        OrbitalElements()
+        {
+        }
+
         double mean_anomoly_;
         double ascending_node_;
         double argument_perigee_;
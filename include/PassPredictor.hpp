@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PASSPREDICTOR_H_
+#define PASSPREDICTOR_H_
+
+#include "CoordTopocentric.hpp"
+#include "DateTime.hpp"
+#include "Observer.hpp"
+#include "SGP4.hpp"
+#include "TimeSpan.hpp"
+
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief One pass of a satellite over an observer.
+     */
+    struct PassDetails
+    {
+        /** acquisition of signal, when the satellite rises above the minimum elevation */
+        DateTime aos;
+        /** the time of maximum elevation */
+        DateTime culmination;
+        /** loss of signal, when the satellite sets below the minimum elevation */
+        DateTime los;
+        /** look angle at aos */
+        CoordTopocentric aos_look_angle;
+        /** look angle at culmination */
+        CoordTopocentric culmination_look_angle;
+        /** look angle at los */
+        CoordTopocentric los_look_angle;
+        /** the pass was already in progress at the start of the search, aos is the start */
+        bool aos_at_start;
+        /** the pass was still in progress at the end of the search, los is the end */
+        bool los_at_end;
+    };
+
+    /**
+     * @brief Finds the passes of a satellite over an observer.
+     *
+     * The elevation is sampled at coarse time steps. A change of sign
+     * relative to the minimum elevation brackets aos or los, which Brent's
+     * method then refines. Culmination is refined by Brent's minimisation
+     * around the highest sample. A local maximum of the samples below the
+     * minimum elevation is refined too, so passes shorter than a step are
+     * still found.
+     */
+    class PassPredictor
+    {
+    public:
+        /**
+         * @param[in] sgp4 the satellite
+         * @param[in] observer the observer
+         * @param[in] min_elevation the elevation in radians above which the
+         * satellite counts as visible
+         */
+        PassPredictor(const SGP4 &sgp4,
+                      const Observer &observer,
+                      double min_elevation = 0.0);
+
+        /**
+         * Set the step between elevation samples. Defaults to a twentieth of
+         * the orbital period, at most ten minutes.
+         * @param[in] step the time step
+         */
+        void SetTimeStep(const TimeSpan &step);
+
+        /**
+         * Set the accuracy of aos, los and culmination. Defaults to 10 ms.
+         * @param[in] tolerance the accuracy
+         */
+        void SetTolerance(const TimeSpan &tolerance);
+
+        /**
+         * @brief Find every pass between two times
+         *
+         * @param[in] start the start of the search
+         * @param[in] end the end of the search
+         * If the satellite decays, or otherwise fails to propagate, the
+         * search ends at the last time step before; a pass in progress there
+         * is returned with los_at_end set.
+         *
+         * @returns the passes in time order
+         */
+        std::vector<PassDetails> FindPasses(const DateTime &start,
+                                            const DateTime &end) const;
+
+    private:
+        friend class VisibilityScheduler;
+
+        /*
+         * the default time step in seconds
+         */
+        static double DefaultTimeStep(const SGP4 &sgp4);
+
+        /*
+         * sample times in seconds from the start, step apart and ending at span
+         */
+        static std::vector<double> SampleTimes(double step, double span);
+
+        /*
+         * append the passes bracketed by elevations above min_elevation,
+         * sampled at times seconds from start
+         */
+        static void FindPasses(const SGP4 &sgp4,
+                               const Observer &observer,
+                               double min_elevation,
+                               double tolerance,
+                               const DateTime &start,
+                               const std::vector<double> &times,
+                               const std::vector<double> &elevations,
+                               std::vector<PassDetails> &passes);
+
+        SGP4 sgp4_;
+        Observer observer_;
+        double min_elevation_;
+        /*
+         * step and tolerance in seconds
+         */
+        double time_step_;
+        double tolerance_;
+    };
+};
+
+#endif
@@ -23,8 +23,14 @@
 #include "SatelliteException.hpp"
 #include "DecayedException.hpp"
 
+#include <memory>
+
 namespace LSGP4
 {
+    class CatalogSnapshot;
+    class SatelliteCatalogPropagator;
+    class Tracker;
+
     /**
      * @mainpage
      *
@@ -37,26 +43,265 @@ namespace LSGP4
     class SGP4
     {
     public:
+        /**
+         * @brief Resonance integrator state of a deep-space model.
+         *
+         * The integrator of resonant deep-space orbits steps from epoch in
+         * half-day increments. A state passed to successive FindPosition()
+         * calls lets each one continue from the step the previous one reached,
+         * instead of from epoch; the result is identical either way. A state
+         * belongs to one caller and one model at a time, the model itself is
+         * never modified, so any number of threads can propagate the same
+         * SGP4 object concurrently.
+         */
+        struct IntegratorParams
+        {
+            IntegratorParams()
+                : xli(0.0), xni(0.0), atime(0.0)
+            {
+            }
+
+            /*
+             * integrator values
+             */
+            double xli;
+            double xni;
+            double atime;
+        };
+
+        /**
+         * Result of a propagation, in the order the model checks for them.
+         * The near-space model reports the same results as the deep-space
+         * model, except for MEAN_MOTION.
+         */
+        enum Status
+        {
+            OK,
+            /** e <= -0.001 */
+            ECCENTRICITY,
+            /** elsq >= 1.0 */
+            ELSQ,
+            /** pl < 0.0 */
+            SEMI_LATUS_RECTUM,
+            /** the position is valid, but below the surface of the earth */
+            DECAYED,
+            /** xn <= 0.0, from the deep-space model only */
+            MEAN_MOTION
+        };
+
         SGP4(const Tle &tle)
-            : elements_(tle), tle_(tle)
+            : tle_(std::make_shared<const Tle>(tle)),
+              elements_(tle),
+              record_(tle.Record()),
+              use_integrator_checkpoints_(true)
+        {
+            Initialise();
+        }
+
+        /**
+         * @brief Initialise from a decoded element set, as held by a
+         * TleCatalog, with no Tle in between
+         *
+         * @param[in] record the element set
+         */
+        SGP4(const TleRecord &record)
+            : elements_(record), record_(record), use_integrator_checkpoints_(true)
         {
             Initialise();
         }
 
         void SetTle(const Tle &tle);
         /**
-         * @brief Get the TLE for this SGP4 model
-         * 
-         * @return const Tle& 
+         * @brief Get the TLE for this SGP4 model, with its name and lines
+         *
+         * Copies of this object share the Tle.
+         *
+         * @return const Tle&
+         * @exception TleException if the model was not built from a Tle;
+         * use GetRecord() instead
+         */
+        const Tle &GetTle() const
+        {
+            if (!tle_)
+            {
+                throw TleException("SGP4 model was not built from a Tle");
+            }
+            return *tle_;
+        }
+        /**
+         * @returns whether the model was built from a Tle, so GetTle() is
+         * available
+         */
+        bool HasTle() const
+        {
+            return static_cast<bool>(tle_);
+        }
+        /**
+         * @brief Get the element set this SGP4 model was initialised from
+         *
+         * @return const TleRecord&
          */
-        const Tle& GetTle() const
+        const TleRecord &GetRecord() const
         {
-            return tle_;
+            return record_;
         }
+        /**
+         * @brief Get the orbital elements derived from the element set
+         *
+         * @return const OrbitalElements&
+         */
+        const OrbitalElements &GetOrbitalElements() const
+        {
+            return elements_;
+        }
+        /**
+         * @brief Enable or disable the resonance integrator checkpoints
+         *
+         * Resonant deep-space orbits are integrated from epoch in 720 minute
+         * steps. With checkpoints enabled, each step is computed once and
+         * kept, so propagating to any time starts from the nearest step
+         * instead of from epoch, unless the caller's IntegratorParams is
+         * already as close. Results are identical either way. Checkpoints
+         * are enabled by default, so the FindPosition() overloads without
+         * a state cost no more far from epoch than near it. Copies of this
+         * object share the checkpoints; reading them takes no lock, and only
+         * extending the table past its furthest step serialises threads.
+         * Disabling them frees the table, for models only ever propagated
+         * through a caller's state.
+         *
+         * @param[in] enable whether to keep checkpoints
+         */
+        void SetIntegratorCheckpoints(bool enable);
         Eci FindPosition(double tsince) const;
         Eci FindPosition(const DateTime &date) const;
+        /**
+         * @brief Find the position and velocity of the satellite, continuing
+         * the deep-space resonance integration held in a caller-owned state
+         *
+         * @param[in] tsince time since epoch in minutes
+         * @param[in,out] state integrator state, default constructed before
+         * first use with this model
+         */
+        Eci FindPosition(double tsince, IntegratorParams &state) const;
+        Eci FindPosition(const DateTime &date, IntegratorParams &state) const;
+        /**
+         * @brief Find the position and velocity of the satellite at several
+         * times since epoch
+         *
+         * Equivalent to calling FindPosition(double) for each entry of
+         * tsince, without constructing an Eci per sample. Throws on the first
+         * sample that fails, in which case the earlier samples have already
+         * been written.
+         *
+         * @param[in] tsince array of n times since epoch in minutes
+         * @param[in] n number of samples
+         * @param[out] positions array of n positions in kilometers
+         * @param[out] velocities array of n velocities in kilometers per second
+         */
+        void FindPositions(const double *tsince,
+                           size_t n,
+                           Vector *positions,
+                           Vector *velocities) const;
+        /**
+         * @brief Find the position and velocity of the satellite, reporting
+         * a failure instead of throwing it
+         *
+         * As FindPosition(double, IntegratorParams &), for callers such as
+         * catalog sweeps where failures are common and unwinding for each
+         * would be costly. A decayed satellite reports the position and
+         * velocity at which it decayed, as DecayedException does; any other
+         * failure reports zero vectors.
+         *
+         * @param[in] tsince time since epoch in minutes
+         * @param[in,out] integ_params integrator state, default constructed
+         * before first use with this model
+         * @param[out] position position in kilometers
+         * @param[out] velocity velocity in kilometers per second
+         * @returns SGP4::OK, or the failure
+         */
+        Status FindPosition(double tsince,
+                            IntegratorParams &integ_params,
+                            Vector &position,
+                            Vector &velocity) const;
+        /**
+         * @brief Find the position and velocity of the satellite at several
+         * times since epoch, reporting failures per sample instead of
+         * throwing them
+         *
+         * As FindPosition(double, IntegratorParams &, Vector &, Vector &)
+         * for each entry of tsince, continuing the resonance integration
+         * from one sample to the next.
+         *
+         * @param[in] tsince array of n times since epoch in minutes
+         * @param[in] n number of samples
+         * @param[out] positions array of n positions in kilometers
+         * @param[out] velocities array of n velocities in kilometers per second
+         * @param[out] status array of n SGP4::Status values
+         */
+        void FindPositions(const double *tsince,
+                           size_t n,
+                           Vector *positions,
+                           Vector *velocities,
+                           unsigned char *status) const;
+        /**
+         * @brief Find the position and velocity of the satellite with the
+         * model chosen at compile time
+         *
+         * The model flags are template parameters instead of being tested
+         * at run time, so a catalog grouped by UseDeepSpace() and
+         * UseSimpleModel() can propagate each group in a loop with no branch
+         * on the model. Results are identical to
+         * FindPosition(double, IntegratorParams &, Vector &, Vector &),
+         * failures included. Instantiated for the
+         * near-space, simple near-space and deep-space models; the flags
+         * must be the satellite's own.
+         *
+         * @tparam DeepSpace UseDeepSpace()
+         * @tparam SimpleModel UseSimpleModel()
+         * @param[in] tsince time since epoch in minutes
+         * @param[in,out] integ_params integrator state, unused by near-space
+         * models
+         * @param[out] position position in kilometers
+         * @param[out] velocity velocity in kilometers per second
+         * @returns SGP4::OK, or the failure
+         */
+        template <bool DeepSpace, bool SimpleModel>
+        Status FindPosition(double tsince,
+                            IntegratorParams &integ_params,
+                            Vector &position,
+                            Vector &velocity) const;
+        /**
+         * @returns whether the deep-space model is used, for a period of
+         * 225 minutes or more
+         */
+        bool UseDeepSpace() const
+        {
+            return use_deep_space_;
+        }
+        /**
+         * @returns whether the simple near-space model is used, for a
+         * perigee below 220 kilometers
+         */
+        bool UseSimpleModel() const
+        {
+            return use_simple_model_;
+        }
 
     private:
+        friend class CatalogSnapshot;
+        friend class NearSpaceKernel;
+        friend class SatelliteCatalogPropagator;
+        friend class Tracker;
+
+        /*
+         * a model whose constants the caller fills in, without Initialise()
+         */
+        SGP4(const OrbitalElements &elements, const TleRecord &record)
+            : elements_(elements), record_(record), use_integrator_checkpoints_(true)
+        {
+            Reset();
+        }
+
         struct CommonConstants
         {
             double cosio;
@@ -164,14 +409,23 @@ namespace LSGP4
             } shape;
         };
 
-        struct IntegratorParams
+        struct IntegratorCheckpoints;
+
+        /*
+         * the last solution of Kepler's equation, which seeds the next when
+         * propagating to a sequence of nearby times
+         */
+        struct KeplerSeed
         {
-            /*
-             * integrator values
-             */
-            double xli;
-            double xni;
-            double atime;
+            KeplerSeed()
+                : valid(false), capu(0.0), epw(0.0), fdot(1.0)
+            {
+            }
+
+            bool valid;
+            double capu;
+            double epw;
+            double fdot;
         };
 
         void Initialise();
@@ -183,10 +437,21 @@ namespace LSGP4
                                        double &x7thm1,
                                        double &xlcof,
                                        double &aycof);
-        Eci FindPositionSDP4(const double tsince) const;
-        Eci FindPositionSGP4(double tsince) const;
-        static Eci CalculateFinalPositionVelocity(
-            const DateTime &date,
+        /*
+         * the models report failures as a SGP4::Status, with zero
+         * vectors for any failure but DECAYED
+         */
+        Status FindPositionSDP4(const double tsince,
+                                IntegratorParams &integ_params,
+                                Vector &position,
+                                Vector &velocity,
+                                KeplerSeed *seed = NULL) const;
+        template <bool SimpleModel>
+        Status FindPositionSGP4(const double tsince,
+                                Vector &position,
+                                Vector &velocity,
+                                KeplerSeed *seed = NULL) const;
+        static Status CalculateFinalPositionVelocity(
             const double e,
             const double a,
             const double omega,
@@ -199,7 +464,17 @@ namespace LSGP4
             const double x1mth2,
             const double x7thm1,
             const double cosio,
-            const double sinio);
+            const double sinio,
+            Vector &position,
+            Vector &velocity,
+            KeplerSeed *seed = NULL);
+        /**
+         * Throw the exception for a failed propagation
+         */
+        void ThrowStatus(Status status,
+                         const double tsince,
+                         const Vector &position,
+                         const Vector &velocity) const;
         /**
          * Deep space initialisation
          */
@@ -224,6 +499,23 @@ namespace LSGP4
             double &omgasm,
             double &xnodes,
             double &xll);
+        /**
+         * Deep space resonance integrator rates at atime
+         */
+        static void DeepSpaceIntegratorRates(
+            const OrbitalElements &elements,
+            const CommonConstants &c_constants,
+            const DeepSpaceConstants &ds_constants,
+            const IntegratorParams &integ_params,
+            double &xndot,
+            double &xnddt,
+            double &xldot);
+        /**
+         * Start the integrator from the checkpoint nearest tsince, if it is
+         * closer than the state in integ_params
+         */
+        void SeekIntegratorCheckpoint(const double tsince,
+                                      IntegratorParams &integ_params) const;
         /**
          * Deep space secular effects
          */
@@ -251,19 +543,25 @@ namespace LSGP4
         struct CommonConstants common_consts_;
         struct NearSpaceConstants nearspace_consts_;
         struct DeepSpaceConstants deepspace_consts_;
-        mutable struct IntegratorParams integrator_params_;
 
         /*
-         * the orbit data
+         * resonance integrator states, shared by copies
+         */
+        std::shared_ptr<IntegratorCheckpoints> integrator_checkpoints_;
+
+        /*
+         * the orbit data, and the Tle it came from if any, shared by copies
          */
+        std::shared_ptr<const Tle> tle_;
         OrbitalElements elements_;
-        Tle tle_;
+        TleRecord record_;
 
         /*
          * flags
          */
         bool use_simple_model_;
         bool use_deep_space_;
+        bool use_integrator_checkpoints_;
     };
 };
 #endif
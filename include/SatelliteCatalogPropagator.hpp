@@ -0,0 +1,217 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SATELLITECATALOGPROPAGATOR_H_
+#define SATELLITECATALOGPROPAGATOR_H_
+
+#include "NearSpaceKernel.hpp"
+#include "SGP4.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+#include <stdint.h>
+
+namespace LSGP4
+{
+    /**
+     * @brief Propagates a whole catalog of satellites to a common time.
+     *
+     * The constants SGP4::Initialise() derives for each near-space object are
+     * packed into columns and propagated by NearSpaceKernel, several objects
+     * per instruction on CPUs with vector extensions. Deep-space objects keep
+     * one SGP4 model each and are propagated individually, by the deep-space
+     * variant of SGP4::FindPosition() with no test of the model per object.
+     */
+    class SatelliteCatalogPropagator
+    {
+    public:
+        /**
+         * @param[in] tles the catalog. Objects whose elements the SGP4 model
+         * rejects are kept, but never produce a valid position.
+         */
+        SatelliteCatalogPropagator(const std::vector<Tle> &tles);
+
+        /**
+         * @param[in] records the catalog as decoded element sets, as from a
+         * TleCatalog. Objects whose elements the SGP4 model rejects are kept,
+         * but never produce a valid position.
+         */
+        SatelliteCatalogPropagator(const std::vector<TleRecord> &records);
+
+        /**
+         * @param[in] satellites the catalog as initialised models, as from a
+         * CatalogSnapshot
+         */
+        SatelliteCatalogPropagator(const std::vector<SGP4> &satellites);
+
+        /**
+         * @returns the number of objects in the catalog
+         */
+        size_t Size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @returns the number of objects propagated with the near-space model
+         */
+        size_t NearSpaceCount() const
+        {
+            return near_index_.size();
+        }
+
+        /**
+         * @returns the near-space kernel implementation in use
+         */
+        NearSpaceKernel::Isa KernelIsa() const
+        {
+            return isa_;
+        }
+
+        /**
+         * Select the near-space kernel implementation. Defaults to
+         * NearSpaceKernel::BestIsa(); NearSpaceKernel::SCALAR reproduces
+         * SGP4::FindPosition() exactly.
+         * @param[in] isa an implementation the CPU supports
+         */
+        void SetKernelIsa(NearSpaceKernel::Isa isa);
+
+        /**
+         * @returns whether near-space objects are propagated in single
+         * precision
+         */
+        bool SinglePrecision() const
+        {
+            return single_precision_;
+        }
+
+        /**
+         * Propagate near-space objects with NearSpaceKernel::PropagateFloat(),
+         * for display and coarse screening, at an error of metres. Off by
+         * default; deep-space objects are always propagated in double
+         * precision.
+         * @param[in] enable whether to use single precision
+         */
+        void SetSinglePrecision(bool enable);
+
+        /**
+         * @brief Find the position and velocity of every object at a common time
+         *
+         * Output arrays are indexed in catalog order. Objects that fail to
+         * propagate are flagged in valid; a decayed object still reports the
+         * position at which it decayed, any other failure reports zero vectors.
+         *
+         * @param[in] dt the time to propagate to
+         * @param[out] positions array of Size() positions in kilometers
+         * @param[out] velocities array of Size() velocities in kilometers per second
+         * @param[out] valid optional array of Size() flags
+         */
+        void FindPositions(const DateTime &dt,
+                           Vector *positions,
+                           Vector *velocities,
+                           bool *valid = NULL) const;
+
+        /**
+         * @brief Find the position and velocity of every object, each at its
+         * own time since epoch
+         *
+         * As FindPositions(const DateTime &, ...), with tsince[i] the time
+         * since the epoch of object i in minutes.
+         *
+         * @param[in] tsince array of Size() times since epoch in minutes
+         * @param[out] positions array of Size() positions in kilometers
+         * @param[out] velocities array of Size() velocities in kilometers per second
+         * @param[out] valid optional array of Size() flags
+         */
+        void FindPositions(const double *tsince,
+                           Vector *positions,
+                           Vector *velocities,
+                           bool *valid = NULL) const;
+
+        /**
+         * @brief Find the position and velocity of every object at each of
+         * several times, spread over a thread pool
+         *
+         * The work is split into tasks of a block of objects by a block of
+         * times, with deep-space objects in smaller tasks since each costs
+         * several near-space ones. Results are as FindPositions(const DateTime &, ...)
+         * for each time, stored in catalog order with the times of one object
+         * together: element i * count + j is object i at times[j], whichever
+         * thread computed it.
+         *
+         * @param[in] times array of count times
+         * @param[in] count number of times
+         * @param[in] pool the threads to use
+         * @param[out] positions array of Size() * count positions in kilometers
+         * @param[out] velocities array of Size() * count velocities in kilometers per second
+         * @param[out] valid optional array of Size() * count flags
+         */
+        void FindPositions(const DateTime *times,
+                           size_t count,
+                           ThreadPool &pool,
+                           Vector *positions,
+                           Vector *velocities,
+                           bool *valid = NULL) const;
+
+    private:
+        void Add(size_t index, const SGP4 &sgp4, std::vector<SGP4> &near);
+        void PackNearSpace(const std::vector<SGP4> &near);
+
+        void PropagateNearSpaceTask(const DateTime *times,
+                                    size_t count,
+                                    size_t first,
+                                    size_t last,
+                                    size_t time_first,
+                                    size_t time_last,
+                                    Vector *positions,
+                                    Vector *velocities,
+                                    unsigned char *status,
+                                    bool *valid) const;
+        void PropagateDeepSpaceTask(const DateTime *times,
+                                    size_t count,
+                                    size_t object,
+                                    size_t time_first,
+                                    size_t time_last,
+                                    Vector *positions,
+                                    Vector *velocities,
+                                    bool *valid) const;
+
+        void FindNearSpacePositions(const std::vector<double> &tsince,
+                                    Vector *positions,
+                                    Vector *velocities,
+                                    bool *valid) const;
+        void FindInvalidPositions(Vector *positions,
+                                  Vector *velocities,
+                                  bool *valid) const;
+
+        size_t size_;
+        NearSpaceKernel::Isa isa_;
+        bool single_precision_;
+
+        /*
+         * near-space model inputs, column-wise as NearSpaceKernel::Field
+         */
+        std::vector<size_t> near_index_;
+        std::vector<int64_t> near_epoch_;
+        std::vector<double> near_consts_;
+
+        std::vector<size_t> deep_index_;
+        std::vector<SGP4> deep_;
+        std::vector<size_t> invalid_index_;
+    };
+};
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SHELLINDEX_H_
+#define SHELLINDEX_H_
+
+#include "OrbitalElements.hpp"
+#include "SGP4.hpp"
+#include "TleCatalog.hpp"
+
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief An index of the perigee to apogee shells of a catalog.
+     *
+     * Each object occupies the shell between its perigee and apogee radii,
+     * taken from the recovered semi-major axis and eccentricity of its
+     * OrbitalElements. Two objects whose shells lie more than a distance
+     * apart can never come within that distance of each other, so a query
+     * for the shells overlapping a band of radii gives every object that
+     * could approach an orbit or altitude band, before anything is
+     * propagated.
+     *
+     * The shells are sorted by perigee, with the highest and lowest apogee
+     * below each node of an implicit balanced tree over them. A query that
+     * finds k of n objects visits O((k + 1) log n) nodes, as each object
+     * found can lie at the end of its own path from the root, and fewer
+     * where it copies out whole subtrees that lie in the band.
+     * The shells are those of the mean elements: allow a margin for the
+     * short periodic terms and the drift of the elements when screening.
+     */
+    class ShellIndex
+    {
+    public:
+        /**
+         * @param[in] satellites the catalog
+         */
+        explicit ShellIndex(const std::vector<SGP4> &satellites);
+
+        /**
+         * @param[in] catalog the catalog
+         */
+        explicit ShellIndex(const TleCatalog &catalog);
+
+        /**
+         * @returns the number of objects
+         */
+        size_t Size() const
+        {
+            return perigees_.size();
+        }
+
+        /**
+         * @param[in] i the index of the object
+         * @returns the perigee radius of the object in kilometers
+         */
+        double Perigee(size_t i) const
+        {
+            return perigees_[i];
+        }
+
+        /**
+         * @param[in] i the index of the object
+         * @returns the apogee radius of the object in kilometers
+         */
+        double Apogee(size_t i) const
+        {
+            return apogees_[i];
+        }
+
+        /**
+         * @brief Find the objects whose shells overlap a band of radii
+         *
+         * @param[in] low the lowest radius of the band in kilometers
+         * @param[in] high the highest radius of the band in kilometers
+         * @param[out] objects the indices of the objects found are appended,
+         * in order of perigee
+         */
+        void FindOverlapping(double low, double high, std::vector<size_t> &objects) const;
+
+        /**
+         * @brief Find the objects that could come within a distance of an
+         * orbit
+         *
+         * @param[in] elements the orbit
+         * @param[in] distance the distance in kilometers
+         * @param[out] objects the indices of the objects found are appended,
+         * in order of perigee
+         */
+        void FindNear(const OrbitalElements &elements,
+                      double distance,
+                      std::vector<size_t> &objects) const;
+
+        /**
+         * @brief Find the objects that could pass through an altitude band
+         *
+         * @param[in] low the lowest altitude above the equatorial radius in
+         * kilometers
+         * @param[in] high the highest altitude in kilometers
+         * @param[out] objects the indices of the objects found are appended,
+         * in order of perigee
+         */
+        void FindInBand(double low, double high, std::vector<size_t> &objects) const;
+
+        /**
+         * @param[in] low the lowest radius of the band in kilometers
+         * @param[in] high the highest radius of the band in kilometers
+         * @returns whether the shell of any object overlaps the band
+         */
+        bool Overlaps(double low, double high) const;
+
+        /**
+         * @param[in] elements the orbit
+         * @returns the perigee radius of the orbit in kilometers
+         */
+        static double PerigeeRadius(const OrbitalElements &elements);
+
+        /**
+         * @param[in] elements the orbit
+         * @returns the apogee radius of the orbit in kilometers
+         */
+        static double ApogeeRadius(const OrbitalElements &elements);
+
+    private:
+        void Build();
+        void BuildNode(size_t first, size_t last);
+        void Find(size_t first,
+                  size_t last,
+                  double low,
+                  double high,
+                  std::vector<size_t> *objects,
+                  bool &found) const;
+
+        /*
+         * radii in object order
+         */
+        std::vector<double> perigees_;
+        std::vector<double> apogees_;
+
+        /*
+         * the objects in order of perigee, with their radii, and for the
+         * node at the middle of each range the highest and lowest apogees in
+         * the range
+         */
+        std::vector<size_t> order_;
+        std::vector<double> sorted_perigees_;
+        std::vector<double> sorted_apogees_;
+        std::vector<double> max_apogees_;
+        std::vector<double> min_apogees_;
+    };
+};
+
+#endif
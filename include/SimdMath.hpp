@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SIMDMATH_H_
+#define SIMDMATH_H_
+
+#include "Globals.hpp"
+
+/*
+ * branch free elementary functions for loops the compiler vectorises.
+ * they must be inlined into the loop body, including into functions built
+ * for a wider instruction set than the translation unit.
+ */
+#if defined(_MSC_VER)
+#define SIMDMATH_INLINE __forceinline
+#elif defined(__GNUC__)
+#define SIMDMATH_INLINE inline __attribute__((always_inline))
+#else
+#define SIMDMATH_INLINE inline
+#endif
+
+namespace SimdMath
+{
+    /*
+     * round to nearest integer, for |x| < 2^51
+     */
+    SIMDMATH_INLINE double Round(const double x)
+    {
+        const double magic = 6755399441055744.0;
+        return (x + magic) - magic;
+    }
+
+    /*
+     * reduce to [-pi, pi]
+     */
+    SIMDMATH_INLINE double WrapNegPosPI(const double a)
+    {
+        return a - kTWOPI * Round(a * (1.0 / kTWOPI));
+    }
+
+    /*
+     * sine and cosine, cephes coefficients after reduction by pi/2
+     */
+    SIMDMATH_INLINE void SinCos(const double x, double &s, double &c)
+    {
+        const double j = Round(x * (2.0 / kPI));
+        const double r = ((x - j * 1.57079625129699707031e0) - j * 7.54978941586159635335e-8) - j * 5.39030285815811905290e-15;
+        /*
+         * quadrant 0 - 3
+         */
+        const double q = j - 4.0 * Round(j * 0.25 - 0.375);
+
+        const double z = r * r;
+        const double sr = r + r * z * (((((1.58962301576546568060e-10 * z - 2.50507477628578072866e-8) * z + 2.75573136213857245213e-6) * z - 1.98412698295895385996e-4) * z + 8.33333333332211858878e-3) * z - 1.66666666666666307295e-1);
+        const double cr = 1.0 - 0.5 * z + z * z * (((((-1.13585365213876817300e-11 * z + 2.08757008419747316778e-9) * z - 2.75573141792967388112e-7) * z + 2.48015872888517045348e-5) * z - 1.38888888888730564116e-3) * z + 4.16666666666665929218e-2);
+
+        const bool odd = (q == 1.0) | (q == 3.0);
+        const double sv = odd ? cr : sr;
+        const double cv = odd ? sr : cr;
+        s = q >= 2.0 ? -sv : sv;
+        c = (q == 1.0) | (q == 2.0) ? -cv : cv;
+    }
+
+    /*
+     * arctangent for 0 <= x <= 1, cephes rational approximation
+     */
+    SIMDMATH_INLINE double AtanUnit(const double x)
+    {
+        const bool upper = x > 0.66;
+        const double t = (upper ? x - 1.0 : x) / (upper ? x + 1.0 : 1.0);
+        const double z = t * t;
+        const double p = (((-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z - 7.500855792314704667340e1) * z - 1.228866684490136173410e2) * z - 6.485021904942025371773e1;
+        const double q = ((((z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2) * z + 4.328810604912902668951e2) * z + 4.853903996359136964868e2) * z + 1.945506571482613964425e2;
+        const double a = t * (z * p / q) + t;
+        return upper ? a + (0.25 * kPI + 0.5 * 6.123233995736765886130e-17) : a;
+    }
+
+    SIMDMATH_INLINE double Atan2(const double y, const double x)
+    {
+        const double ax = fabs(x);
+        const double ay = fabs(y);
+        const double mx = ax > ay ? ax : ay;
+        const double mn = ax > ay ? ay : ax;
+        double a = AtanUnit(mn / (mx > 0.0 ? mx : 1.0));
+        a = ay > ax ? 0.5 * kPI - a : a;
+        a = x < 0.0 ? kPI - a : a;
+        return y < 0.0 ? -a : a;
+    }
+
+    /*
+     * single precision versions, for |x| < 2^22, with cephes sinf, cosf and
+     * atanf coefficients
+     */
+    SIMDMATH_INLINE float Round(const float x)
+    {
+        const float magic = 12582912.0f;
+        return (x + magic) - magic;
+    }
+
+    SIMDMATH_INLINE float WrapNegPosPI(const float a)
+    {
+        return a - static_cast<float>(kTWOPI) * Round(a * static_cast<float>(1.0 / kTWOPI));
+    }
+
+    SIMDMATH_INLINE void SinCos(const float x, float &s, float &c)
+    {
+        const float j = Round(x * static_cast<float>(2.0 / kPI));
+        const float r = ((x - j * 1.5703125f) - j * 4.837512969970703125e-4f) - j * 7.54978995489188216e-8f;
+        const float q = j - 4.0f * Round(j * 0.25f - 0.375f);
+
+        const float z = r * r;
+        const float sr = r + r * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f);
+        const float cr = 1.0f - 0.5f * z + z * z * ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f);
+
+        const bool odd = (q == 1.0f) | (q == 3.0f);
+        const float sv = odd ? cr : sr;
+        const float cv = odd ? sr : cr;
+        s = q >= 2.0f ? -sv : sv;
+        c = (q == 1.0f) | (q == 2.0f) ? -cv : cv;
+    }
+
+    SIMDMATH_INLINE float AtanUnit(const float x)
+    {
+        const bool upper = x > 0.4142135623730950f;
+        const float t = (upper ? x - 1.0f : x) / (upper ? x + 1.0f : 1.0f);
+        const float z = t * t;
+        const float a = (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * t + t;
+        return upper ? a + static_cast<float>(0.25 * kPI) : a;
+    }
+
+    SIMDMATH_INLINE float Atan2(const float y, const float x)
+    {
+        const float ax = x < 0.0f ? -x : x;
+        const float ay = y < 0.0f ? -y : y;
+        const float mx = ax > ay ? ax : ay;
+        const float mn = ax > ay ? ay : ax;
+        float a = AtanUnit(mn / (mx > 0.0f ? mx : 1.0f));
+        a = ay > ax ? static_cast<float>(0.5 * kPI) - a : a;
+        a = x < 0.0f ? static_cast<float>(kPI) - a : a;
+        return y < 0.0f ? -a : a;
+    }
+}
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief A fixed set of worker threads that share out indexed tasks by
+     * work stealing.
+     *
+     * ParallelFor() splits the task indices into one contiguous range per
+     * worker. Each worker takes tasks from the front of its own range; a
+     * worker that runs out steals the back half of the largest range left,
+     * so uneven task costs even out without a central queue.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @param[in] threads number of threads, including the thread calling
+         * ParallelFor(). 0 uses one per hardware thread.
+         */
+        explicit ThreadPool(size_t threads = 0);
+        ~ThreadPool();
+
+        /**
+         * @returns the number of threads, including the calling thread
+         */
+        size_t Size() const
+        {
+            return workers_.size();
+        }
+
+        /**
+         * @brief Run task(i) for every i in [0, count) and wait for all of them.
+         *
+         * The calling thread works too. If tasks throw, the remaining tasks
+         * still run and the first exception is rethrown afterwards. Not to be
+         * called from inside a task.
+         *
+         * @param[in] count number of tasks
+         * @param[in] task the task body
+         */
+        void ParallelFor(size_t count, const std::function<void(size_t)> &task);
+
+    private:
+        ThreadPool(const ThreadPool &);
+        ThreadPool &operator=(const ThreadPool &);
+
+        /*
+         * the unclaimed task indices [begin, end) of one worker
+         */
+        struct Worker
+        {
+            std::mutex mutex;
+            size_t begin;
+            size_t end;
+        };
+
+        void ThreadMain(size_t id);
+        void RunTasks(size_t id);
+        bool TakeTask(size_t id, size_t &index);
+        bool StealTasks(size_t id);
+
+        std::vector<Worker> workers_;
+        std::vector<std::thread> threads_;
+
+        /*
+         * the current ParallelFor() call
+         */
+        std::mutex mutex_;
+        std::condition_variable start_;
+        std::condition_variable done_;
+        const std::function<void(size_t)> *task_;
+        size_t generation_;
+        size_t remaining_;
+        size_t busy_;
+        bool stop_;
+        std::exception_ptr error_;
+    };
+};
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TIMEGRID_H_
+#define TIMEGRID_H_
+
+#include "CoordGeodetic.hpp"
+#include "CoordTopocentric.hpp"
+#include "CoordinateKernel.hpp"
+#include "DateTime.hpp"
+#include "Eci.hpp"
+#include "TimeSpan.hpp"
+#include "Vector.hpp"
+
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief A fixed set of times with the sidereal time and observer
+     * positions at each precomputed.
+     *
+     * Observer::GetLookAngle() recomputes the Greenwich sidereal time and the
+     * observer's Eci position whenever the time changes. When many satellites
+     * are evaluated at the same times, a TimeGrid computes these once per
+     * time and observer. Look angles match Observer::GetLookAngle() exactly.
+     */
+    class TimeGrid
+    {
+    public:
+        /**
+         * @param[in] start the first time
+         * @param[in] step the time between consecutive times
+         * @param[in] count the number of times
+         */
+        TimeGrid(const DateTime &start, const TimeSpan &step, size_t count);
+
+        /**
+         * @param[in] times the times
+         */
+        TimeGrid(const std::vector<DateTime> &times);
+
+        /**
+         * @returns the number of times
+         */
+        size_t Size() const
+        {
+            return times_.size();
+        }
+
+        /**
+         * @param[in] i index of the time
+         * @returns the time
+         */
+        const DateTime &Time(size_t i) const
+        {
+            return times_[i];
+        }
+
+        /**
+         * @param[in] i index of the time
+         * @returns the Greenwich mean sidereal time in radians
+         */
+        double GreenwichSiderealTime(size_t i) const
+        {
+            return gmst_[i];
+        }
+
+        /**
+         * Precompute an observer at every time
+         * @param[in] geo the observers position
+         * @returns the index of the observer
+         */
+        size_t AddObserver(const CoordGeodetic &geo);
+
+        /**
+         * @returns the number of observers
+         */
+        size_t ObserverCount() const
+        {
+            return observers_.size();
+        }
+
+        /**
+         * Get the look angle from an observer to an object
+         * @param[in] observer index of the observer
+         * @param[in] i index of the time, which must be the time of eci
+         * @param[in] eci the object
+         * @returns the look angle
+         */
+        CoordTopocentric GetLookAngle(size_t observer, size_t i, const Eci &eci) const;
+
+        /**
+         * Get the look angles from an observer to several objects at one time
+         * @param[in] observer index of the observer
+         * @param[in] i index of the time, which must be the time of every eci
+         * @param[in] eci array of n objects
+         * @param[in] n number of objects
+         * @param[out] look_angles array of n look angles
+         */
+        void GetLookAngles(size_t observer,
+                           size_t i,
+                           const Eci *eci,
+                           size_t n,
+                           CoordTopocentric *look_angles) const;
+
+        /**
+         * Get the look angles from an observer to many objects at one time,
+         * given as arrays of each coordinate, with the vectorised
+         * CoordinateKernel::GetLookAngles()
+         * @param[in] observer index of the observer
+         * @param[in] i index of the time of every object
+         * @param[in] x array of n x coordinates in kilometers
+         * @param[in] y array of n y coordinates in kilometers
+         * @param[in] z array of n z coordinates in kilometers
+         * @param[in] vx array of n x velocities in kilometers per second
+         * @param[in] vy array of n y velocities in kilometers per second
+         * @param[in] vz array of n z velocities in kilometers per second
+         * @param[in] n number of objects
+         * @param[out] azimuth array of n azimuths in radians
+         * @param[out] elevation array of n elevations in radians
+         * @param[out] range array of n ranges in kilometers
+         * @param[out] range_rate array of n range rates in kilometers per
+         * second
+         */
+        void GetLookAngles(size_t observer,
+                           size_t i,
+                           const double *x,
+                           const double *y,
+                           const double *z,
+                           const double *vx,
+                           const double *vy,
+                           const double *vz,
+                           size_t n,
+                           double *azimuth,
+                           double *elevation,
+                           double *range,
+                           double *range_rate) const;
+
+        /**
+         * Convert several objects at one time to geodetic form, with the
+         * vectorised CoordinateKernel::ToGeodetic() and the precomputed
+         * sidereal time
+         * @param[in] i index of the time, which must be the time of every eci
+         * @param[in] eci array of n objects
+         * @param[in] n number of objects
+         * @param[out] geodetic array of n positions in geodetic form
+         */
+        void ToGeodetic(size_t i, const Eci *eci, size_t n, CoordGeodetic *geodetic) const;
+
+    private:
+        void Initialise();
+
+        std::vector<DateTime> times_;
+        std::vector<double> gmst_;
+        std::vector<CoordGeodetic> observers_;
+        /*
+         * each observer at each time, observer major, Size() per observer
+         */
+        std::vector<CoordinateKernel::Station> stations_;
+    };
+};
+
+#endif
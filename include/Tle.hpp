@@ -21,6 +21,7 @@
 #include "Util.hpp"
 #include "DateTime.hpp"
 #include "TleException.hpp"
+#include "TleParser.hpp"
 #include "meb_print.h"
 
 namespace LSGP4
@@ -63,6 +64,14 @@ namespace LSGP4
             Initialize();
         }
 
+        /**
+         * @details Initialise from fields already decoded, as from a
+         * TleCatalog. The lines are not kept, so Line1() and Line2() are
+         * empty, and the name is the norad number.
+         * @param[in] record the decoded fields
+         */
+        explicit Tle(const TleRecord &record);
+
         /**
          * @brief Construct a new Tle object
          * 
@@ -310,6 +319,12 @@ namespace LSGP4
             return orbit_number_;
         }
 
+        /**
+         * Get the decoded fields
+         * @returns the fields as a TleRecord
+         */
+        TleRecord Record() const;
+
         /**
          * Get the expected tle line length
          * @returns the tle line length
@@ -356,10 +371,7 @@ namespace LSGP4
 
     private:
         void Initialize();
-        static bool IsValidLineLength(const std::string &str);
-        void ExtractInteger(const std::string &str, unsigned int &val);
-        void ExtractDouble(const std::string &str, int point_pos, double &val);
-        void ExtractExponential(const std::string &str, double &val);
+        void Assign(const TleRecord &record);
 
     private:
         std::string name_;
@@ -393,9 +405,15 @@ inline std::ostream &operator<<(std::ostream &strm, const LSGP4::Tle &t)
 
 /**
  * @brief Read multiple TLEs from a file
- * 
+ *
+ * The file is read with a TleReader, so each TLE keeps the name line before
+ * it. For large files a TleCatalog, or streaming with a TleReader, avoids
+ * holding a Tle per element set.
+ *
  * @param fname File name
- * @return Vector of TLE objects
+ * @return Vector of TLE objects, in file order
+ * @throws std::invalid_argument if the file cannot be opened
+ * @throws TleException on a malformed element set
  */
 std::vector<LSGP4::Tle> ReadTleFromFile(const char *fname);
 
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TLECATALOG_H_
+#define TLECATALOG_H_
+
+#include "ThreadPool.hpp"
+#include "TleParser.hpp"
+
+#include <string>
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief The element sets of a tle file, held compactly.
+     *
+     * Each element set is kept as its decoded TleRecord, in file order, with
+     * the names packed into one buffer. The file is read with a TleReader,
+     * counting the element sets first so that nothing is copied as the
+     * catalog grows.
+     */
+    class TleCatalog
+    {
+    public:
+        TleCatalog()
+        {
+        }
+
+        /**
+         * @param[in] fname the file to load
+         * @throws std::invalid_argument if the file cannot be opened
+         * @throws TleException on a malformed element set
+         */
+        explicit TleCatalog(const char *fname);
+
+        /**
+         * @brief Load a file across the threads of a pool
+         *
+         * The file is split into chunks at byte offsets, each chunk taking
+         * the element sets whose line two starts within it, and the chunks
+         * are decoded in parallel and joined in order. The catalog is the
+         * same as loading the file on one thread.
+         *
+         * @param[in] fname the file to load
+         * @param[in] pool the threads to decode with
+         * @throws std::invalid_argument if the file cannot be opened
+         * @throws TleException on a malformed element set
+         */
+        TleCatalog(const char *fname, ThreadPool &pool);
+
+        /**
+         * @returns the number of element sets
+         */
+        size_t Size() const
+        {
+            return records_.size();
+        }
+
+        /**
+         * @returns the element sets, contiguous and in file order
+         */
+        const std::vector<TleRecord> &Records() const
+        {
+            return records_;
+        }
+
+        /**
+         * @param[in] i the index of the element set
+         * @returns the decoded fields of the element set
+         */
+        const TleRecord &Record(size_t i) const
+        {
+            return records_[i];
+        }
+
+        /**
+         * @param[in] i the index of the element set
+         * @returns the name of the element set, or its five digit norad
+         * number if it had no name line
+         */
+        std::string Name(size_t i) const;
+
+        /**
+         * @brief Add an element set
+         *
+         * @param[in] record the decoded fields
+         * @param[in] name the name, empty if none
+         * @param[in] name_length the length of the name
+         */
+        void Add(const TleRecord &record, const char *name, size_t name_length);
+
+    private:
+        std::vector<TleRecord> records_;
+        /*
+         * the names, back to back, with name i at
+         * [name_offsets_[i], name_offsets_[i + 1])
+         */
+        std::vector<char> names_;
+        std::vector<size_t> name_offsets_;
+    };
+};
+
+#endif
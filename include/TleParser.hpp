@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TLEPARSER_H_
+#define TLEPARSER_H_
+
+#include "TleException.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace LSGP4
+{
+    /**
+     * @brief The fields of a two-line element set, without the lines or name.
+     *
+     * Angles are in degrees, as written in the element set.
+     */
+    struct TleRecord
+    {
+        /** norad number */
+        unsigned int norad_number;
+        /** international designator, columns 10 - 17 of line one */
+        char int_designator[9];
+        /** epoch in DateTime ticks */
+        int64_t epoch;
+        /** first time derivative of the mean motion divided by two */
+        double mean_motion_dt2;
+        /** second time derivative of the mean motion divided by six */
+        double mean_motion_ddt6;
+        /** BSTAR drag term */
+        double bstar;
+        /** inclination in degrees */
+        double inclination;
+        /** right ascension of the ascending node in degrees */
+        double right_ascending_node;
+        /** eccentricity */
+        double eccentricity;
+        /** argument of perigee in degrees */
+        double argument_perigee;
+        /** mean anomaly in degrees */
+        double mean_anomaly;
+        /** mean motion in revolutions per day */
+        double mean_motion;
+        /** orbit number at epoch */
+        unsigned int orbit_number;
+    };
+
+    /**
+     * @brief Decodes two-line element sets straight from character buffers.
+     *
+     * Fields are decoded in place as fixed point numbers, with no copies and
+     * no heap use. The values are identical to those Tle decodes, and an
+     * element set Tle rejects is rejected with the same message.
+     */
+    class TleParser
+    {
+    public:
+        /**
+         * Decode the two lines of a tle
+         * @param[in] line_one line one, not necessarily terminated
+         * @param[in] length_one length of line one, which must be Tle::LineLength()
+         * @param[in] line_two line two, not necessarily terminated
+         * @param[in] length_two length of line two, which must be Tle::LineLength()
+         * @param[out] record the decoded fields
+         * @exception TleException on a malformed element set
+         */
+        static void Parse(const char *line_one,
+                          size_t length_one,
+                          const char *line_two,
+                          size_t length_two,
+                          TleRecord &record);
+
+        /**
+         * @returns the length of each line of a tle
+         */
+        static size_t LineLength()
+        {
+            return 69;
+        }
+    };
+};
+
+#endif
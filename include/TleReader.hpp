@@ -0,0 +1,171 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TLEREADER_H_
+#define TLEREADER_H_
+
+#include "MappedFile.hpp"
+#include "TleParser.hpp"
+
+#include <cstddef>
+#include <functional>
+
+namespace LSGP4
+{
+    /**
+     * @brief Streams the element sets of a tle file, mapped into memory.
+     *
+     * The file is read in a single pass with each element set decoded in
+     * place by TleParser. A line that is not part of an element set and
+     * comes straight before a line one is taken as the name of that element
+     * set, without a leading "0 " as in three line element files. Lines may
+     * end in "\n" or "\r\n"; lines that do not pair up into an element set
+     * are skipped. Pages already read are handed back to the system, so
+     * archives far larger than memory can be streamed.
+     */
+    class TleReader
+    {
+    public:
+        /**
+         * @param[in] fname the file name
+         * @throws std::invalid_argument if the file cannot be opened
+         */
+        explicit TleReader(const char *fname);
+
+        /**
+         * @brief Decode the next element set
+         *
+         * @param[out] record the decoded fields
+         * @returns false at the end of the file
+         * @throws TleException on a malformed element set
+         */
+        bool Next(TleRecord &record);
+
+        /**
+         * @returns the name of the element set from the last Next(), empty
+         * if it had none. Not terminated.
+         */
+        const char *Name() const
+        {
+            return name_;
+        }
+
+        /**
+         * @returns the length of Name()
+         */
+        size_t NameLength() const
+        {
+            return name_length_;
+        }
+
+        /**
+         * @returns line one of the element set from the last Next(), of
+         * TleParser::LineLength() characters. Not terminated.
+         */
+        const char *LineOne() const
+        {
+            return line_one_;
+        }
+
+        /**
+         * @returns line two of the element set from the last Next(), of
+         * TleParser::LineLength() characters. Not terminated.
+         */
+        const char *LineTwo() const
+        {
+            return line_two_;
+        }
+
+        /**
+         * @returns the offset in bytes within the file of line two of the
+         * element set from the last Next()
+         */
+        size_t Offset() const
+        {
+            return static_cast<size_t>(line_two_ - data_);
+        }
+
+        /**
+         * @returns the size of the file in bytes
+         */
+        size_t Size() const
+        {
+            return size_;
+        }
+
+        /**
+         * @brief Move to an offset within the file
+         *
+         * The next Next() gives the first element set whose line two starts
+         * at or after the offset, named as when reading from the start.
+         *
+         * @param[in] offset the offset in bytes
+         */
+        void Seek(size_t offset);
+
+        /**
+         * @returns an upper bound on the number of element sets in the file,
+         * counted without decoding them
+         */
+        size_t Count() const;
+
+        /**
+         * @brief Return to the start of the file
+         */
+        void Rewind();
+
+        /**
+         * @brief Decode every element set of a file in order
+         *
+         * @param[in] fname the file name
+         * @param[in] callback called with each element set and its name, the
+         * name being empty if it had none
+         * @returns the number of element sets
+         * @throws std::invalid_argument if the file cannot be opened
+         * @throws TleException on a malformed element set
+         */
+        static size_t ForEach(const char *fname,
+                              const std::function<void(const TleRecord &record,
+                                                       const char *name,
+                                                       size_t name_length)> &callback);
+
+    private:
+        TleReader(const TleReader &);
+        TleReader &operator=(const TleReader &);
+
+        void Release();
+
+        MappedFile file_;
+        const char *data_;
+        size_t size_;
+        /*
+         * offset of the next line, and the start of the pages not yet released
+         */
+        size_t position_;
+        size_t released_;
+        /*
+         * element sets whose line two starts before this are passed over
+         */
+        size_t skip_;
+
+        const char *name_;
+        size_t name_length_;
+        const char *line_one_;
+        const char *line_two_;
+    };
+};
+
+#endif
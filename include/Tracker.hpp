@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRACKER_H_
+#define TRACKER_H_
+
+#include "CoordGeodetic.hpp"
+#include "CoordTopocentric.hpp"
+#include "CoordinateKernel.hpp"
+#include "DateTime.hpp"
+#include "SGP4.hpp"
+#include "TimeSpan.hpp"
+#include "Vector.hpp"
+
+namespace LSGP4
+{
+    /**
+     * @brief Follows one satellite from one observer at a fixed rate.
+     *
+     * Each Tick() advances the time by a fixed step and finds the
+     * satellite's position and the look angle to it, for an antenna
+     * controller running at tens of hertz. Everything that does not change
+     * from tick to tick is computed once: the time since epoch and the
+     * sidereal time advance by a fixed amount per tick, the observer's
+     * distance from the Earth's axis and height above the equator are
+     * fixed, and Kepler's equation starts from the previous tick's
+     * solution, which converges in fewer steps than starting from the mean
+     * anomaly. A deep-space satellite's resonance integration continues
+     * from the previous tick.
+     *
+     * Positions match SGP4::FindPosition() to within the convergence of
+     * Kepler's equation, and look angles match Observer::GetLookAngle() to
+     * within the rounding of the sidereal time.
+     */
+    class Tracker
+    {
+    public:
+        /**
+         * The look angle at the start time is found at construction.
+         * @param[in] sgp4 the satellite
+         * @param[in] geo the observer's position
+         * @param[in] start the first time
+         * @param[in] step the time between ticks
+         */
+        Tracker(const SGP4 &sgp4, const CoordGeodetic &geo, const DateTime &start, const TimeSpan &step);
+
+        /**
+         * Advance to the next time and find the look angle
+         */
+        void Tick();
+
+        /**
+         * Restart from another time, keeping the satellite, observer and
+         * step
+         * @param[in] start the new first time
+         */
+        void Reset(const DateTime &start);
+
+        /**
+         * @returns the number of ticks since the start time
+         */
+        size_t Ticks() const
+        {
+            return ticks_;
+        }
+
+        /**
+         * @returns the current time
+         */
+        DateTime Time() const
+        {
+            return start_.AddTicks(static_cast<int64_t>(ticks_) * step_.Ticks());
+        }
+
+        /**
+         * @returns the satellite's position in kilometers
+         */
+        const Vector &Position() const
+        {
+            return position_;
+        }
+
+        /**
+         * @returns the satellite's velocity in kilometers per second
+         */
+        const Vector &Velocity() const
+        {
+            return velocity_;
+        }
+
+        /**
+         * @returns the look angle from the observer to the satellite
+         */
+        const CoordTopocentric &LookAngle() const
+        {
+            return look_angle_;
+        }
+
+    private:
+        void Update();
+
+        SGP4 sgp4_;
+        TimeSpan step_;
+        DateTime start_;
+        size_t ticks_;
+
+        /*
+         * time since epoch at the start and the step, in minutes
+         */
+        double start_tsince_;
+        double step_minutes_;
+
+        /*
+         * local mean sidereal time at the start and its advance per tick
+         */
+        double start_theta_;
+        double step_theta_;
+
+        /*
+         * the observer, which turns with the Earth at a fixed distance from
+         * its axis and height above the equator
+         */
+        double longitude_;
+        CoordinateKernel::Station station_;
+
+        SGP4::IntegratorParams integ_params_;
+        SGP4::KeplerSeed seed_;
+
+        Vector position_;
+        Vector velocity_;
+        CoordTopocentric look_angle_;
+    };
+};
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VISIBILITYSCHEDULER_H_
+#define VISIBILITYSCHEDULER_H_
+
+#include "PassPredictor.hpp"
+
+#include <vector>
+
+namespace LSGP4
+{
+    /**
+     * @brief A pass of one satellite over one ground station.
+     */
+    struct Contact
+    {
+        /** index of the satellite */
+        size_t satellite;
+        /** index of the ground station */
+        size_t station;
+        /** the pass */
+        PassDetails pass;
+    };
+
+    /**
+     * @brief Finds the passes of many satellites over many ground stations.
+     *
+     * Each satellite is propagated once per time step and the elevation from
+     * every station is taken from that one position, with the sidereal time
+     * and station positions shared through a TimeGrid. The time step is the
+     * default PassPredictor step of the fastest satellite. Passes are then
+     * bracketed and refined per satellite and station as PassPredictor does,
+     * giving the same passes as a PassPredictor with that time step for each
+     * pair.
+     */
+    class VisibilityScheduler
+    {
+    public:
+        /**
+         * @param[in] satellites the satellites
+         * @param[in] stations the ground stations
+         * @param[in] min_elevation the elevation in radians above which a
+         * satellite counts as visible from a station
+         */
+        VisibilityScheduler(const std::vector<SGP4> &satellites,
+                            const std::vector<Observer> &stations,
+                            double min_elevation = 0.0);
+
+        /**
+         * Set the accuracy of aos, los and culmination. Defaults to 10 ms.
+         * @param[in] tolerance the accuracy
+         */
+        void SetTolerance(const TimeSpan &tolerance);
+
+        /**
+         * @brief Find every contact between two times
+         *
+         * @param[in] start the start of the search
+         * @param[in] end the end of the search
+         * The search for a satellite that decays, or otherwise fails to
+         * propagate, ends at the last time step before, as in
+         * PassPredictor::FindPasses().
+         *
+         * @returns the contacts of every satellite and station, ordered by
+         * aos, then satellite, then station
+         */
+        std::vector<Contact> FindContacts(const DateTime &start,
+                                          const DateTime &end) const;
+
+    private:
+        std::vector<SGP4> satellites_;
+        std::vector<Observer> stations_;
+        double min_elevation_;
+        /*
+         * tolerance in seconds
+         */
+        double tolerance_;
+    };
+};
+
+#endif
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CatalogSnapshot.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    const char kMagic[8] = {'L', 'S', 'G', 'P', '4', 'C', 'A', 'T'};
+
+    /*
+     * reads back as a different value with the other byte order
+     */
+    const uint32_t kByteOrder = 0x01020304;
+}
+
+namespace LSGP4
+{
+    struct CatalogSnapshot::Header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        uint32_t entry_size;
+        uint32_t reserved;
+        uint64_t count;
+    };
+
+    struct CatalogSnapshot::Entry
+    {
+        TleRecord record;
+
+        /*
+         * OrbitalElements, in declaration order, less the epoch which is in
+         * the record
+         */
+        double mean_anomoly;
+        double ascending_node;
+        double argument_perigee;
+        double eccentricity;
+        double inclination;
+        double mean_motion;
+        double bstar;
+        double recovered_semi_major_axis;
+        double recovered_mean_motion;
+        double perigee;
+        double period;
+
+        SGP4::CommonConstants common_consts;
+        SGP4::NearSpaceConstants nearspace_consts;
+        SGP4::DeepSpaceConstants deepspace_consts;
+
+        uint32_t use_simple_model;
+        uint32_t use_deep_space;
+    };
+
+    CatalogSnapshot::CatalogSnapshot(const char *fname)
+        : file_(fname), size_(0)
+    {
+        Header header;
+
+        if (file_.Size() < sizeof(header))
+        {
+            throw std::invalid_argument("Not a catalog snapshot");
+        }
+
+        memcpy(&header, file_.Data(), sizeof(header));
+
+        if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+        {
+            throw std::invalid_argument("Not a catalog snapshot");
+        }
+
+        /*
+         * the version first, as another version may lay out entries
+         * differently
+         */
+        if (header.version != Version())
+        {
+            throw std::invalid_argument("Unsupported catalog snapshot version");
+        }
+
+        if (header.byte_order != kByteOrder || header.entry_size != sizeof(Entry))
+        {
+            throw std::invalid_argument("Catalog snapshot written by an incompatible build");
+        }
+
+        if ((file_.Size() - sizeof(header)) / sizeof(Entry) < header.count)
+        {
+            throw std::invalid_argument("Catalog snapshot is truncated");
+        }
+
+        size_ = static_cast<size_t>(header.count);
+    }
+
+    const CatalogSnapshot::Entry &CatalogSnapshot::GetEntry(size_t i) const
+    {
+        /*
+         * the mapping is page aligned and the header a multiple of eight
+         * bytes, so entries are aligned as in memory
+         */
+        return reinterpret_cast<const Entry *>(file_.Data() + sizeof(Header))[i];
+    }
+
+    const TleRecord &CatalogSnapshot::Record(size_t i) const
+    {
+        return GetEntry(i).record;
+    }
+
+    SGP4 CatalogSnapshot::Satellite(size_t i) const
+    {
+        const Entry &entry = GetEntry(i);
+
+        OrbitalElements elements;
+        elements.mean_anomoly_ = entry.mean_anomoly;
+        elements.ascending_node_ = entry.ascending_node;
+        elements.argument_perigee_ = entry.argument_perigee;
+        elements.eccentricity_ = entry.eccentricity;
+        elements.inclination_ = entry.inclination;
+        elements.mean_motion_ = entry.mean_motion;
+        elements.bstar_ = entry.bstar;
+        elements.recovered_semi_major_axis_ = entry.recovered_semi_major_axis;
+        elements.recovered_mean_motion_ = entry.recovered_mean_motion;
+        elements.perigee_ = entry.perigee;
+        elements.period_ = entry.period;
+        elements.epoch_ = DateTime(entry.record.epoch);
+
+        SGP4 sgp4(elements, entry.record);
+        sgp4.common_consts_ = entry.common_consts;
+        sgp4.nearspace_consts_ = entry.nearspace_consts;
+        sgp4.deepspace_consts_ = entry.deepspace_consts;
+        sgp4.use_simple_model_ = entry.use_simple_model != 0;
+        sgp4.use_deep_space_ = entry.use_deep_space != 0;
+        sgp4.SetIntegratorCheckpoints(true);
+
+        return sgp4;
+    }
+
+    std::vector<SGP4> CatalogSnapshot::Satellites() const
+    {
+        std::vector<SGP4> satellites;
+        satellites.reserve(size_);
+
+        for (size_t i = 0; i < size_; i++)
+        {
+            satellites.push_back(Satellite(i));
+        }
+
+        return satellites;
+    }
+
+    void CatalogSnapshot::Write(const char *fname, const std::vector<SGP4> &satellites)
+    {
+        FILE *fp = fopen(fname, "wb");
+        if (fp == NULL)
+        {
+            throw std::invalid_argument("Could not access file");
+        }
+
+        Header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = Version();
+        header.byte_order = kByteOrder;
+        header.entry_size = sizeof(Entry);
+        header.count = satellites.size();
+
+        bool ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+
+        for (size_t i = 0; ok && i < satellites.size(); i++)
+        {
+            const SGP4 &sgp4 = satellites[i];
+            const TleRecord &record = sgp4.record_;
+            const OrbitalElements &elements = sgp4.elements_;
+
+            /*
+             * zero the padding too, so equal catalogs give equal files
+             */
+            Entry entry;
+            memset(&entry, 0, sizeof(entry));
+
+            entry.record.norad_number = record.norad_number;
+            memcpy(entry.record.int_designator, record.int_designator, sizeof(record.int_designator));
+            entry.record.epoch = record.epoch;
+            entry.record.mean_motion_dt2 = record.mean_motion_dt2;
+            entry.record.mean_motion_ddt6 = record.mean_motion_ddt6;
+            entry.record.bstar = record.bstar;
+            entry.record.inclination = record.inclination;
+            entry.record.right_ascending_node = record.right_ascending_node;
+            entry.record.eccentricity = record.eccentricity;
+            entry.record.argument_perigee = record.argument_perigee;
+            entry.record.mean_anomaly = record.mean_anomaly;
+            entry.record.mean_motion = record.mean_motion;
+            entry.record.orbit_number = record.orbit_number;
+
+            entry.mean_anomoly = elements.mean_anomoly_;
+            entry.ascending_node = elements.ascending_node_;
+            entry.argument_perigee = elements.argument_perigee_;
+            entry.eccentricity = elements.eccentricity_;
+            entry.inclination = elements.inclination_;
+            entry.mean_motion = elements.mean_motion_;
+            entry.bstar = elements.bstar_;
+            entry.recovered_semi_major_axis = elements.recovered_semi_major_axis_;
+            entry.recovered_mean_motion = elements.recovered_mean_motion_;
+            entry.perigee = elements.perigee_;
+            entry.period = elements.period_;
+
+            entry.common_consts = sgp4.common_consts_;
+            entry.nearspace_consts = sgp4.nearspace_consts_;
+            entry.deepspace_consts = sgp4.deepspace_consts_;
+            entry.use_simple_model = sgp4.use_simple_model_ ? 1 : 0;
+            entry.use_deep_space = sgp4.use_deep_space_ ? 1 : 0;
+
+            ok = fwrite(&entry, sizeof(entry), 1, fp) == 1;
+        }
+
+        if (fclose(fp) != 0 || !ok)
+        {
+            throw std::invalid_argument("Could not write file");
+        }
+    }
+};
@@ -0,0 +1,624 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConjunctionScreener.hpp"
+
+#include "Globals.hpp"
+#include "ShellIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdint.h>
+
+namespace
+{
+    using namespace LSGP4;
+
+    /*
+     * how far in kilometers the radius of an object may stray outside the
+     * perigee and apogee of its mean elements, from the short periodic
+     * terms and the drift of the elements over a screening
+     */
+    const double kShellMargin = 50.0;
+
+    /*
+     * an upper bound on the relative acceleration of two objects in km/s^2,
+     * twice surface gravity
+     */
+    const double kMaxRelativeAcceleration = 2.0 * kMU / (kXKMPER * kXKMPER);
+
+    /*
+     * windows propagated together per thread of a pool
+     */
+    const size_t kWindowsPerThread = 2;
+
+    /*
+     * range rate iterations before giving up on a root
+     */
+    const int kMaxIterations = 100;
+
+    /*
+     * every window, and every step of a refinement, propagates from a fresh
+     * integrator state, so deep-space objects must start from checkpoints
+     * rather than from epoch, whatever the caller set on its own models
+     */
+    std::vector<SGP4> WithCheckpoints(std::vector<SGP4> satellites)
+    {
+        for (size_t i = 0; i < satellites.size(); i++)
+        {
+            satellites[i].SetIntegratorCheckpoints(true);
+        }
+        return satellites;
+    }
+
+    bool ConjunctionBefore(const Conjunction &a, const Conjunction &b)
+    {
+        if (a.tca != b.tca)
+        {
+            return a.tca < b.tca;
+        }
+        if (a.primary != b.primary)
+        {
+            return a.primary < b.primary;
+        }
+        return a.secondary < b.secondary;
+    }
+}
+
+namespace LSGP4
+{
+    struct ConjunctionScreener::Window
+    {
+        /*
+         * the start of the search, and per object the minutes from its epoch
+         * to it
+         */
+        DateTime start;
+        const double *offsets;
+
+        /*
+         * seconds since the start of the search
+         */
+        double first;
+        double middle;
+        double last;
+    };
+
+    /*
+     * positions hashed into cubic cells, each cell a chain of the objects in
+     * it. cells are found by open addressing on the packed cell coordinates
+     */
+    class ConjunctionScreener::CellGrid
+    {
+    public:
+        CellGrid(double cell_size, size_t count)
+            : inverse_(1.0 / cell_size)
+        {
+            size_t capacity = 16;
+            while (capacity < 2 * count)
+            {
+                capacity *= 2;
+            }
+            mask_ = capacity - 1;
+            shift_ = 64;
+            for (size_t c = capacity; c > 1; c /= 2)
+            {
+                shift_--;
+            }
+            keys_.resize(capacity);
+            heads_.assign(capacity, -1);
+            objects_.reserve(count);
+            next_.reserve(count);
+        }
+
+        void Insert(size_t object, const Vector &position)
+        {
+            const uint64_t key = Key(Cell(position.x), Cell(position.y), Cell(position.z));
+            const size_t slot = Find(key);
+            keys_[slot] = key;
+            next_.push_back(heads_[slot]);
+            heads_[slot] = static_cast<int32_t>(objects_.size());
+            objects_.push_back(object);
+        }
+
+        /*
+         * every object in the cell of the position or one next to it
+         */
+        template <typename Function>
+        void ForEachNear(const Vector &position, Function function) const
+        {
+            const int64_t x = Cell(position.x);
+            const int64_t y = Cell(position.y);
+            const int64_t z = Cell(position.z);
+
+            for (int64_t i = x - 1; i <= x + 1; i++)
+            {
+                for (int64_t j = y - 1; j <= y + 1; j++)
+                {
+                    for (int64_t k = z - 1; k <= z + 1; k++)
+                    {
+                        const uint64_t key = Key(i, j, k);
+                        const size_t slot = Find(key);
+                        for (int32_t e = heads_[slot]; e >= 0; e = next_[e])
+                        {
+                            function(objects_[e]);
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        int64_t Cell(double coordinate) const
+        {
+            return static_cast<int64_t>(floor(coordinate * inverse_));
+        }
+
+        /*
+         * 21 bits per coordinate. cells that far apart share a key, which
+         * only adds candidates
+         */
+        static uint64_t Key(int64_t x, int64_t y, int64_t z)
+        {
+            const uint64_t mask = 0x1FFFFF;
+            return ((static_cast<uint64_t>(x) & mask) << 42) |
+                   ((static_cast<uint64_t>(y) & mask) << 21) |
+                   (static_cast<uint64_t>(z) & mask);
+        }
+
+        /*
+         * the slot holding the key, or the empty slot it would go in
+         */
+        size_t Find(uint64_t key) const
+        {
+            size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift_);
+            while (heads_[slot] >= 0 && keys_[slot] != key)
+            {
+                slot = (slot + 1) & mask_;
+            }
+            return slot;
+        }
+
+        double inverse_;
+        size_t mask_;
+        int shift_;
+        std::vector<uint64_t> keys_;
+        std::vector<int32_t> heads_;
+        std::vector<size_t> objects_;
+        std::vector<int32_t> next_;
+    };
+
+    ConjunctionScreener::ConjunctionScreener(const std::vector<SGP4> &primaries,
+                                             const std::vector<SGP4> &secondaries,
+                                             double threshold)
+        : threshold_(threshold),
+          self_(false),
+          primary_count_(0),
+          satellites_(WithCheckpoints(Select(primaries, secondaries))),
+          propagator_(satellites_),
+          step_(60.0),
+          tolerance_(0.001)
+    {
+    }
+
+    ConjunctionScreener::ConjunctionScreener(const std::vector<SGP4> &catalog,
+                                             double threshold)
+        : threshold_(threshold),
+          self_(true),
+          primary_count_(0),
+          satellites_(WithCheckpoints(Select(catalog, std::vector<SGP4>()))),
+          propagator_(satellites_),
+          step_(60.0),
+          tolerance_(0.001)
+    {
+    }
+
+    std::vector<SGP4> ConjunctionScreener::Select(const std::vector<SGP4> &primaries,
+                                                  const std::vector<SGP4> &secondaries)
+    {
+        std::vector<SGP4> selected;
+
+        if (self_)
+        {
+            for (size_t i = 0; i < primaries.size(); i++)
+            {
+                const OrbitalElements &elements = primaries[i].GetOrbitalElements();
+                indices_.push_back(i);
+                perigees_.push_back(ShellIndex::PerigeeRadius(elements));
+                apogees_.push_back(ShellIndex::ApogeeRadius(elements));
+                norad_numbers_.push_back(primaries[i].GetRecord().norad_number);
+            }
+            primary_count_ = primaries.size();
+            return primaries;
+        }
+
+        /*
+         * an object whose shell overlaps no shell of the other catalog cannot
+         * approach any of its objects
+         */
+        const std::vector<SGP4> *catalogs[2] = {&primaries, &secondaries};
+        const ShellIndex shells[2] = {ShellIndex(primaries), ShellIndex(secondaries)};
+        const double margin = threshold_ + 2.0 * kShellMargin;
+        for (int c = 0; c < 2; c++)
+        {
+            for (size_t i = 0; i < catalogs[c]->size(); i++)
+            {
+                const double perigee = shells[c].Perigee(i);
+                const double apogee = shells[c].Apogee(i);
+                if (shells[1 - c].Overlaps(perigee - margin, apogee + margin))
+                {
+                    const SGP4 &sgp4 = (*catalogs[c])[i];
+                    selected.push_back(sgp4);
+                    indices_.push_back(i);
+                    perigees_.push_back(perigee);
+                    apogees_.push_back(apogee);
+                    norad_numbers_.push_back(sgp4.GetRecord().norad_number);
+                }
+            }
+            if (c == 0)
+            {
+                primary_count_ = selected.size();
+            }
+        }
+
+        return selected;
+    }
+
+    void ConjunctionScreener::SetTimeStep(const TimeSpan &step)
+    {
+        step_ = step.TotalSeconds();
+    }
+
+    void ConjunctionScreener::SetTolerance(const TimeSpan &tolerance)
+    {
+        tolerance_ = tolerance.TotalSeconds();
+    }
+
+    std::vector<Conjunction> ConjunctionScreener::FindConjunctions(const DateTime &start,
+                                                                   const DateTime &end) const
+    {
+        return Screen(start, end, NULL);
+    }
+
+    std::vector<Conjunction> ConjunctionScreener::FindConjunctions(const DateTime &start,
+                                                                   const DateTime &end,
+                                                                   ThreadPool &pool) const
+    {
+        return Screen(start, end, &pool);
+    }
+
+    std::vector<Conjunction> ConjunctionScreener::Screen(const DateTime &start,
+                                                         const DateTime &end,
+                                                         ThreadPool *pool) const
+    {
+        std::vector<Conjunction> conjunctions;
+        const double span = (end - start).TotalSeconds();
+        if (!(span > 0.0) || satellites_.empty())
+        {
+            return conjunctions;
+        }
+
+        const size_t count = static_cast<size_t>(std::max(1.0, ceil(span / step_)));
+        const double width = span / count;
+
+        std::vector<double> offsets(satellites_.size());
+        for (size_t i = 0; i < satellites_.size(); i++)
+        {
+            offsets[i] = (start - satellites_[i].GetOrbitalElements().Epoch()).TotalMinutes();
+        }
+
+        std::vector<Window> windows(count);
+        std::vector<DateTime> middles(count);
+        for (size_t w = 0; w < count; w++)
+        {
+            windows[w].start = start;
+            windows[w].offsets = offsets.data();
+            windows[w].first = width * w;
+            windows[w].last = w + 1 == count ? span : width * (w + 1);
+            windows[w].middle = 0.5 * (windows[w].first + windows[w].last);
+            middles[w] = start.AddSeconds(windows[w].middle);
+        }
+
+        const size_t batch = pool ? std::max<size_t>(1, pool->Size()) * kWindowsPerThread : 1;
+        const size_t n = satellites_.size();
+        std::vector<Vector> positions(n * batch);
+        std::vector<Vector> velocities(n * batch);
+        std::unique_ptr<bool[]> valid(new bool[n * batch]);
+        std::vector<std::vector<Conjunction> > found(batch);
+
+        for (size_t w = 0; w < count; w += batch)
+        {
+            const size_t windows_in_batch = std::min(batch, count - w);
+
+            if (pool)
+            {
+                /*
+                 * object i at window j is element i * windows_in_batch + j
+                 */
+                propagator_.FindPositions(&middles[w], windows_in_batch, *pool,
+                                          positions.data(), velocities.data(), valid.get());
+                pool->ParallelFor(windows_in_batch, [&](size_t j)
+                                  {
+                                      found[j].clear();
+                                      ScreenWindow(windows[w + j],
+                                                   &positions[j],
+                                                   &velocities[j],
+                                                   &valid[j],
+                                                   windows_in_batch,
+                                                   found[j]);
+                                  });
+                for (size_t j = 0; j < windows_in_batch; j++)
+                {
+                    conjunctions.insert(conjunctions.end(), found[j].begin(), found[j].end());
+                }
+            }
+            else
+            {
+                propagator_.FindPositions(middles[w], positions.data(), velocities.data(), valid.get());
+                ScreenWindow(windows[w], positions.data(), velocities.data(), valid.get(), 1, conjunctions);
+            }
+        }
+
+        std::sort(conjunctions.begin(), conjunctions.end(), ConjunctionBefore);
+
+        return conjunctions;
+    }
+
+    void ConjunctionScreener::ScreenWindow(const Window &window,
+                                           const Vector *positions,
+                                           const Vector *velocities,
+                                           const bool *valid,
+                                           size_t stride,
+                                           std::vector<Conjunction> &conjunctions) const
+    {
+        const size_t n = satellites_.size();
+        const double half = 0.5 * (window.last - window.first);
+
+        /*
+         * two objects within half a window of the middle close at most at
+         * twice the top speed, and straight line motion strays from their
+         * paths by at most the curvature
+         */
+        double top_speed = 0.0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (valid[i * stride])
+            {
+                top_speed = std::max(top_speed, velocities[i * stride].Magnitude());
+            }
+        }
+        const double curvature = 0.5 * kMaxRelativeAcceleration * half * half;
+        const double reach = threshold_ + curvature;
+        const double cell_size = std::max(reach + 2.0 * top_speed * half, 1.0);
+        const double shell_margin = threshold_ + kShellMargin;
+
+        /*
+         * grid the larger side and probe it from the smaller
+         */
+        size_t grid_first = 0;
+        size_t grid_last = n;
+        size_t probe_first = 0;
+        size_t probe_last = n;
+        if (!self_)
+        {
+            const bool grid_primaries = primary_count_ >= n - primary_count_;
+            grid_first = grid_primaries ? 0 : primary_count_;
+            grid_last = grid_primaries ? primary_count_ : n;
+            probe_first = grid_primaries ? primary_count_ : 0;
+            probe_last = grid_primaries ? n : primary_count_;
+        }
+
+        CellGrid grid(cell_size, grid_last - grid_first);
+        for (size_t i = grid_first; i < grid_last; i++)
+        {
+            if (valid[i * stride])
+            {
+                grid.Insert(i, positions[i * stride]);
+            }
+        }
+
+        for (size_t p = probe_first; p < probe_last; p++)
+        {
+            if (!valid[p * stride])
+            {
+                continue;
+            }
+
+            const Vector &position = positions[p * stride];
+            const Vector &velocity = velocities[p * stride];
+
+            grid.ForEachNear(position, [&](size_t g)
+                             {
+                                 if (self_ && g <= p)
+                                 {
+                                     return;
+                                 }
+                                 if (norad_numbers_[p] == norad_numbers_[g])
+                                 {
+                                     return;
+                                 }
+                                 if (perigees_[p] > apogees_[g] + shell_margin ||
+                                     perigees_[g] > apogees_[p] + shell_margin)
+                                 {
+                                     return;
+                                 }
+
+                                 /*
+                                  * closest straight line approach within the
+                                  * window
+                                  */
+                                 const Vector &other = positions[g * stride];
+                                 const Vector &other_velocity = velocities[g * stride];
+                                 const double rx = other.x - position.x;
+                                 const double ry = other.y - position.y;
+                                 const double rz = other.z - position.z;
+                                 const double vx = other_velocity.x - velocity.x;
+                                 const double vy = other_velocity.y - velocity.y;
+                                 const double vz = other_velocity.z - velocity.z;
+                                 const double vv = vx * vx + vy * vy + vz * vz;
+                                 double tau = vv > 0.0 ? -(rx * vx + ry * vy + rz * vz) / vv : 0.0;
+                                 tau = std::max(-half, std::min(half, tau));
+                                 const double dx = rx + vx * tau;
+                                 const double dy = ry + vy * tau;
+                                 const double dz = rz + vz * tau;
+                                 if (dx * dx + dy * dy + dz * dz > reach * reach)
+                                 {
+                                     return;
+                                 }
+
+                                 /*
+                                  * primary first
+                                  */
+                                 const bool p_first = self_ || p < primary_count_;
+                                 const size_t a = p_first ? p : g;
+                                 const size_t b = p_first ? g : p;
+
+                                 Conjunction conjunction;
+                                 if (Refine(a, b, window, conjunction))
+                                 {
+                                     conjunctions.push_back(conjunction);
+                                 }
+                             });
+        }
+    }
+
+    bool ConjunctionScreener::RelativeState(size_t a,
+                                            size_t b,
+                                            const Window &window,
+                                            double seconds,
+                                            Vector &position,
+                                            Vector &velocity) const
+    {
+        /*
+         * a pair with either object failing to propagate, decayed included,
+         * is skipped
+         */
+        SGP4::IntegratorParams state_a;
+        SGP4::IntegratorParams state_b;
+        Vector position_a;
+        Vector velocity_a;
+        Vector position_b;
+        Vector velocity_b;
+        if (satellites_[a].FindPosition(window.offsets[a] + seconds / 60.0, state_a, position_a, velocity_a) != SGP4::OK ||
+            satellites_[b].FindPosition(window.offsets[b] + seconds / 60.0, state_b, position_b, velocity_b) != SGP4::OK)
+        {
+            return false;
+        }
+        position = position_b - position_a;
+        velocity = velocity_b - velocity_a;
+        return true;
+    }
+
+    bool ConjunctionScreener::Refine(size_t a,
+                                     size_t b,
+                                     const Window &window,
+                                     Conjunction &conjunction) const
+    {
+        Vector r;
+        Vector v;
+
+        /*
+         * closest approach is where the range rate, and so r.v, turns from
+         * negative to positive. without that turn within the window the
+         * closest approach lies outside it
+         */
+        double lo = window.first;
+        double hi = window.last;
+        if (!RelativeState(a, b, window, lo, r, v))
+        {
+            return false;
+        }
+        double f_lo = r.Dot(v);
+        if (!RelativeState(a, b, window, hi, r, v))
+        {
+            return false;
+        }
+        double f_hi = r.Dot(v);
+        if (!(f_lo < 0.0 && f_hi >= 0.0))
+        {
+            return false;
+        }
+
+        /*
+         * regula falsi, halving the value held at an end that stays put
+         */
+        double t = hi;
+        int side = 0;
+        for (int i = 0; i < kMaxIterations && hi - lo > tolerance_; i++)
+        {
+            const double previous = t;
+            t = (lo * f_hi - hi * f_lo) / (f_hi - f_lo);
+            if (!(t > lo && t < hi))
+            {
+                t = 0.5 * (lo + hi);
+            }
+            if (!RelativeState(a, b, window, t, r, v))
+            {
+                return false;
+            }
+
+            const double f = r.Dot(v);
+            if (f < 0.0)
+            {
+                lo = t;
+                f_lo = f;
+                if (side == -1)
+                {
+                    f_hi *= 0.5;
+                }
+                side = -1;
+            }
+            else
+            {
+                hi = t;
+                f_hi = f;
+                if (side == 1)
+                {
+                    f_lo *= 0.5;
+                }
+                side = 1;
+            }
+
+            if (fabs(t - previous) < 0.5 * tolerance_)
+            {
+                break;
+            }
+        }
+
+        if (!RelativeState(a, b, window, t, r, v))
+        {
+            return false;
+        }
+        const double miss = r.Magnitude();
+        if (miss > threshold_)
+        {
+            return false;
+        }
+
+        conjunction.primary = indices_[a];
+        conjunction.secondary = indices_[b];
+        if (self_ && conjunction.primary > conjunction.secondary)
+        {
+            std::swap(conjunction.primary, conjunction.secondary);
+        }
+        conjunction.tca = window.start.AddSeconds(t);
+        conjunction.miss_distance = miss;
+        conjunction.relative_speed = v.Magnitude();
+
+        return true;
+    }
+};
@@ -0,0 +1,540 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CoordinateKernel.hpp"
+
+#include "Globals.hpp"
+#include "SimdMath.hpp"
+
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COORDINATEKERNEL_X86
+#endif
+
+namespace LSGP4
+{
+    namespace
+    {
+        /*
+         * Bowring steps for W points at a time. every step is a loop over
+         * the lanes, so that each one compiles to a single vector operation.
+         * results are stored from locals in a loop of their own, since the
+         * compiler otherwise guards against the output arrays overlapping
+         * with a scalar copy of the whole computation.
+         */
+        template <int W>
+        SIMDMATH_INLINE void GeodeticLanes(const double gmst,
+                                           const double *px,
+                                           const double *py,
+                                           const double *pz,
+                                           double *latitude,
+                                           double *longitude,
+                                           double *altitude)
+        {
+            static const double a = kXKMPER;
+            static const double b = kXKMPER * (1.0 - kF);
+            static const double e2 = kF * (2.0 - kF);
+            static const double ep2 = e2 / ((1.0 - kF) * (1.0 - kF));
+
+            double x[W];
+            double y[W];
+            double z[W];
+            double p[W];
+            double num[W];
+            double den[W];
+            double lat[W];
+            double lon[W];
+            double alt[W];
+
+            for (int l = 0; l < W; l++)
+            {
+                x[l] = px[l];
+                y[l] = py[l];
+                z[l] = pz[l];
+                p[l] = sqrt(x[l] * x[l] + y[l] * y[l]);
+
+                /*
+                 * the reduced latitude of the point's geocentric direction
+                 */
+                num[l] = z[l];
+                den[l] = p[l];
+            }
+
+            for (int step = 0; step < 2; step++)
+            {
+                for (int l = 0; l < W; l++)
+                {
+                    const double u = (1.0 - kF) * num[l];
+                    const double v = den[l];
+                    const double h = sqrt(u * u + v * v);
+                    const double inv = 1.0 / (h > 0.0 ? h : 1.0);
+                    const double sinb = h > 0.0 ? u * inv : 1.0;
+                    const double cosb = v * inv;
+
+                    num[l] = z[l] + ep2 * b * sinb * sinb * sinb;
+                    den[l] = p[l] - e2 * a * cosb * cosb * cosb;
+                }
+            }
+
+            for (int l = 0; l < W; l++)
+            {
+                const double h = sqrt(num[l] * num[l] + den[l] * den[l]);
+                const double inv = 1.0 / (h > 0.0 ? h : 1.0);
+                const double sinphi = h > 0.0 ? num[l] * inv : 1.0;
+                const double cosphi = den[l] * inv;
+
+                lat[l] = SimdMath::Atan2(num[l], den[l]);
+                alt[l] = p[l] * cosphi + z[l] * sinphi - a * sqrt(1.0 - e2 * sinphi * sinphi);
+                lon[l] = SimdMath::WrapNegPosPI(SimdMath::Atan2(y[l], x[l]) - gmst);
+            }
+
+            for (int l = 0; l < W; l++)
+            {
+                latitude[l] = lat[l];
+                longitude[l] = lon[l];
+                altitude[l] = alt[l];
+            }
+        }
+
+        /*
+         * whole blocks of W points straight from the arrays, the remainder
+         * from a padded copy
+         */
+        template <int W>
+        SIMDMATH_INLINE void GeodeticBlocks(const double gmst,
+                                            const double *x,
+                                            const double *y,
+                                            const double *z,
+                                            const size_t n,
+                                            double *latitude,
+                                            double *longitude,
+                                            double *altitude)
+        {
+            size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                GeodeticLanes<W>(gmst, x + i, y + i, z + i, latitude + i, longitude + i, altitude + i);
+            }
+
+            if (i < n)
+            {
+                const size_t lanes = n - i;
+                double tx[W];
+                double ty[W];
+                double tz[W];
+                double lat[W];
+                double lon[W];
+                double alt[W];
+                for (int l = 0; l < W; l++)
+                {
+                    const size_t src = i + (static_cast<size_t>(l) < lanes ? l : lanes - 1);
+                    tx[l] = x[src];
+                    ty[l] = y[src];
+                    tz[l] = z[src];
+                }
+
+                GeodeticLanes<W>(gmst, tx, ty, tz, lat, lon, alt);
+
+                for (size_t l = 0; l < lanes; l++)
+                {
+                    latitude[i + l] = lat[l];
+                    longitude[i + l] = lon[l];
+                    altitude[i + l] = alt[l];
+                }
+            }
+        }
+
+        /*
+         * look angles for W objects at a time
+         */
+        template <int W>
+        SIMDMATH_INLINE void LookAngleLanes(const CoordinateKernel::Station &station,
+                                            const double *px,
+                                            const double *py,
+                                            const double *pz,
+                                            const double *pvx,
+                                            const double *pvy,
+                                            const double *pvz,
+                                            double *azimuth,
+                                            double *elevation,
+                                            double *range,
+                                            double *range_rate)
+        {
+            /*
+             * the station in locals, which the outputs cannot alias, and the
+             * rows of the rotation from Eci to south, east and zenith
+             */
+            const double ox = station.position[0];
+            const double oy = station.position[1];
+            const double oz = station.position[2];
+            const double ovx = station.velocity[0];
+            const double ovy = station.velocity[1];
+            const double ovz = station.velocity[2];
+            const double s_x = station.sin_lat * station.cos_theta;
+            const double s_y = station.sin_lat * station.sin_theta;
+            const double s_z = -station.cos_lat;
+            const double e_x = -station.sin_theta;
+            const double e_y = station.cos_theta;
+            const double z_x = station.cos_lat * station.cos_theta;
+            const double z_y = station.cos_lat * station.sin_theta;
+            const double z_z = station.sin_lat;
+
+            double rx[W];
+            double ry[W];
+            double rz[W];
+            double dot[W];
+            double az[W];
+            double el[W];
+            double rg[W];
+            double rr[W];
+
+            for (int l = 0; l < W; l++)
+            {
+                rx[l] = px[l] - ox;
+                ry[l] = py[l] - oy;
+                rz[l] = pz[l] - oz;
+                dot[l] = rx[l] * (pvx[l] - ovx) + ry[l] * (pvy[l] - ovy) + rz[l] * (pvz[l] - ovz);
+            }
+
+            for (int l = 0; l < W; l++)
+            {
+                const double w = sqrt(rx[l] * rx[l] + ry[l] * ry[l] + rz[l] * rz[l]);
+                const double top_s = s_x * rx[l] + s_y * ry[l] + s_z * rz[l];
+                const double top_e = e_x * rx[l] + e_y * ry[l];
+                const double top_z = z_x * rx[l] + z_y * ry[l] + z_z * rz[l];
+
+                const double a = SimdMath::Atan2(top_e, -top_s);
+                az[l] = a < 0.0 ? a + kTWOPI : a;
+                el[l] = SimdMath::Atan2(top_z, sqrt(top_s * top_s + top_e * top_e));
+                rg[l] = w;
+                rr[l] = dot[l] / w;
+            }
+
+            for (int l = 0; l < W; l++)
+            {
+                azimuth[l] = az[l];
+                elevation[l] = el[l];
+                range[l] = rg[l];
+                range_rate[l] = rr[l];
+            }
+        }
+
+        template <int W>
+        SIMDMATH_INLINE void LookAngleBlocks(const CoordinateKernel::Station &station,
+                                             const double *x,
+                                             const double *y,
+                                             const double *z,
+                                             const double *vx,
+                                             const double *vy,
+                                             const double *vz,
+                                             const size_t n,
+                                             double *azimuth,
+                                             double *elevation,
+                                             double *range,
+                                             double *range_rate)
+        {
+            size_t i = 0;
+            for (; i + W <= n; i += W)
+            {
+                LookAngleLanes<W>(station, x + i, y + i, z + i, vx + i, vy + i, vz + i,
+                                  azimuth + i, elevation + i, range + i, range_rate + i);
+            }
+
+            if (i < n)
+            {
+                const size_t lanes = n - i;
+                double tx[W];
+                double ty[W];
+                double tz[W];
+                double tvx[W];
+                double tvy[W];
+                double tvz[W];
+                double az[W];
+                double el[W];
+                double rg[W];
+                double rr[W];
+                for (int l = 0; l < W; l++)
+                {
+                    const size_t src = i + (static_cast<size_t>(l) < lanes ? l : lanes - 1);
+                    tx[l] = x[src];
+                    ty[l] = y[src];
+                    tz[l] = z[src];
+                    tvx[l] = vx[src];
+                    tvy[l] = vy[src];
+                    tvz[l] = vz[src];
+                }
+
+                LookAngleLanes<W>(station, tx, ty, tz, tvx, tvy, tvz, az, el, rg, rr);
+
+                for (size_t l = 0; l < lanes; l++)
+                {
+                    azimuth[i + l] = az[l];
+                    elevation[i + l] = el[l];
+                    range[i + l] = rg[l];
+                    range_rate[i + l] = rr[l];
+                }
+            }
+        }
+
+#ifdef COORDINATEKERNEL_X86
+        __attribute__((target("avx512f"))) void GeodeticAvx512(const double gmst,
+                                                               const double *x,
+                                                               const double *y,
+                                                               const double *z,
+                                                               const size_t n,
+                                                               double *latitude,
+                                                               double *longitude,
+                                                               double *altitude)
+        {
+            GeodeticBlocks<8>(gmst, x, y, z, n, latitude, longitude, altitude);
+        }
+
+        __attribute__((target("avx2"))) void GeodeticAvx2(const double gmst,
+                                                          const double *x,
+                                                          const double *y,
+                                                          const double *z,
+                                                          const size_t n,
+                                                          double *latitude,
+                                                          double *longitude,
+                                                          double *altitude)
+        {
+            GeodeticBlocks<4>(gmst, x, y, z, n, latitude, longitude, altitude);
+        }
+
+        __attribute__((target("avx512f"))) void LookAngleAvx512(const CoordinateKernel::Station &station,
+                                                                const double *x,
+                                                                const double *y,
+                                                                const double *z,
+                                                                const double *vx,
+                                                                const double *vy,
+                                                                const double *vz,
+                                                                const size_t n,
+                                                                double *azimuth,
+                                                                double *elevation,
+                                                                double *range,
+                                                                double *range_rate)
+        {
+            LookAngleBlocks<8>(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+        }
+
+        __attribute__((target("avx2"))) void LookAngleAvx2(const CoordinateKernel::Station &station,
+                                                           const double *x,
+                                                           const double *y,
+                                                           const double *z,
+                                                           const double *vx,
+                                                           const double *vy,
+                                                           const double *vz,
+                                                           const size_t n,
+                                                           double *azimuth,
+                                                           double *elevation,
+                                                           double *range,
+                                                           double *range_rate)
+        {
+            LookAngleBlocks<4>(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+        }
+#endif
+
+        /*
+         * the baseline instruction set of the target, SSE2 on x86-64
+         */
+        void GeodeticSse2(const double gmst,
+                          const double *x,
+                          const double *y,
+                          const double *z,
+                          const size_t n,
+                          double *latitude,
+                          double *longitude,
+                          double *altitude)
+        {
+            GeodeticBlocks<4>(gmst, x, y, z, n, latitude, longitude, altitude);
+        }
+
+        void GeodeticScalar(const double gmst,
+                            const double *x,
+                            const double *y,
+                            const double *z,
+                            const size_t n,
+                            double *latitude,
+                            double *longitude,
+                            double *altitude)
+        {
+            GeodeticBlocks<1>(gmst, x, y, z, n, latitude, longitude, altitude);
+        }
+
+        void LookAngleSse2(const CoordinateKernel::Station &station,
+                           const double *x,
+                           const double *y,
+                           const double *z,
+                           const double *vx,
+                           const double *vy,
+                           const double *vz,
+                           const size_t n,
+                           double *azimuth,
+                           double *elevation,
+                           double *range,
+                           double *range_rate)
+        {
+            LookAngleBlocks<4>(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+        }
+
+        void LookAngleScalar(const CoordinateKernel::Station &station,
+                             const double *x,
+                             const double *y,
+                             const double *z,
+                             const double *vx,
+                             const double *vy,
+                             const double *vz,
+                             const size_t n,
+                             double *azimuth,
+                             double *elevation,
+                             double *range,
+                             double *range_rate)
+        {
+            LookAngleBlocks<1>(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+        }
+    }
+
+    void CoordinateKernel::SetLocation(const CoordGeodetic &geo, Station &station)
+    {
+        station.sin_lat = sin(geo.latitude);
+        station.cos_lat = cos(geo.latitude);
+
+        /*
+         * take into account earth flattening
+         */
+        const double c = 1.0 / sqrt(1.0 + kF * (kF - 2.0) * station.sin_lat * station.sin_lat);
+        const double s = (1.0 - kF) * (1.0 - kF) * c;
+        station.axis_distance = (kXKMPER * c + geo.altitude) * station.cos_lat;
+        station.height = (kXKMPER * s + geo.altitude) * station.sin_lat;
+    }
+
+    void CoordinateKernel::SetSiderealTime(double theta, Station &station)
+    {
+        static const double mfactor = kTWOPI * (kOMEGA_E / kSECONDS_PER_DAY);
+
+        station.sin_theta = sin(theta);
+        station.cos_theta = cos(theta);
+
+        station.position[0] = station.axis_distance * station.cos_theta;
+        station.position[1] = station.axis_distance * station.sin_theta;
+        station.position[2] = station.height;
+
+        station.velocity[0] = -mfactor * station.position[1];
+        station.velocity[1] = mfactor * station.position[0];
+        station.velocity[2] = 0.0;
+    }
+
+    CoordTopocentric CoordinateKernel::GetLookAngle(const Station &station,
+                                                    const Vector &position,
+                                                    const Vector &velocity)
+    {
+        const double rx = position.x - station.position[0];
+        const double ry = position.y - station.position[1];
+        const double rz = position.z - station.position[2];
+        const double rvx = velocity.x - station.velocity[0];
+        const double rvy = velocity.y - station.velocity[1];
+        const double rvz = velocity.z - station.velocity[2];
+        const double range = sqrt(rx * rx + ry * ry + rz * rz);
+
+        const double sin_lat = station.sin_lat;
+        const double cos_lat = station.cos_lat;
+        const double sin_theta = station.sin_theta;
+        const double cos_theta = station.cos_theta;
+
+        const double top_s = sin_lat * cos_theta * rx + sin_lat * sin_theta * ry - cos_lat * rz;
+        const double top_e = -sin_theta * rx + cos_theta * ry;
+        const double top_z = cos_lat * cos_theta * rx + cos_lat * sin_theta * ry + sin_lat * rz;
+        double az = atan(-top_e / top_s);
+
+        if (top_s > 0.0)
+        {
+            az += kPI;
+        }
+
+        if (az < 0.0)
+        {
+            az += 2.0 * kPI;
+        }
+
+        return CoordTopocentric(az,
+                                asin(top_z / range),
+                                range,
+                                (rx * rvx + ry * rvy + rz * rvz) / range);
+    }
+
+    void CoordinateKernel::ToGeodetic(NearSpaceKernel::Isa isa,
+                                      double gmst,
+                                      const double *x,
+                                      const double *y,
+                                      const double *z,
+                                      size_t n,
+                                      double *latitude,
+                                      double *longitude,
+                                      double *altitude)
+    {
+        switch (isa)
+        {
+#ifdef COORDINATEKERNEL_X86
+        case NearSpaceKernel::AVX512:
+            GeodeticAvx512(gmst, x, y, z, n, latitude, longitude, altitude);
+            break;
+        case NearSpaceKernel::AVX2:
+            GeodeticAvx2(gmst, x, y, z, n, latitude, longitude, altitude);
+            break;
+#endif
+        case NearSpaceKernel::SSE2:
+            GeodeticSse2(gmst, x, y, z, n, latitude, longitude, altitude);
+            break;
+        default:
+            GeodeticScalar(gmst, x, y, z, n, latitude, longitude, altitude);
+            break;
+        }
+    }
+
+    void CoordinateKernel::GetLookAngles(NearSpaceKernel::Isa isa,
+                                         const Station &station,
+                                         const double *x,
+                                         const double *y,
+                                         const double *z,
+                                         const double *vx,
+                                         const double *vy,
+                                         const double *vz,
+                                         size_t n,
+                                         double *azimuth,
+                                         double *elevation,
+                                         double *range,
+                                         double *range_rate)
+    {
+        switch (isa)
+        {
+#ifdef COORDINATEKERNEL_X86
+        case NearSpaceKernel::AVX512:
+            LookAngleAvx512(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+            break;
+        case NearSpaceKernel::AVX2:
+            LookAngleAvx2(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+            break;
+#endif
+        case NearSpaceKernel::SSE2:
+            LookAngleSse2(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+            break;
+        default:
+            LookAngleScalar(station, x, y, z, vx, vy, vz, n, azimuth, elevation, range, range_rate);
+            break;
+        }
+    }
+};
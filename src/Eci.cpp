@@ -16,6 +16,7 @@
 
 #include "Eci.hpp"
 
+#include "CoordinateKernel.hpp"
 #include "Globals.hpp"
 #include "Util.hpp"
 namespace LSGP4
@@ -32,19 +33,12 @@ namespace LSGP4
      */
         m_dt = dt;
 
-        static const double mfactor = kTWOPI * (kOMEGA_E / kSECONDS_PER_DAY);
-
         /*
      * Calculate Local Mean Sidereal Time for observers longitude
      */
-        const double theta = m_dt.ToLocalMeanSiderealTime(geo.longitude);
-
-        /*
-     * take into account earth flattening
-     */
-        const double c = 1.0 / sqrt(1.0 + kF * (kF - 2.0) * pow(sin(geo.latitude), 2.0));
-        const double s = pow(1.0 - kF, 2.0) * c;
-        const double achcp = (kXKMPER * c + geo.altitude) * cos(geo.latitude);
+        CoordinateKernel::Station station;
+        CoordinateKernel::SetLocation(geo, station);
+        CoordinateKernel::SetSiderealTime(m_dt.ToLocalMeanSiderealTime(geo.longitude), station);
 
         /*
      * X position in km
@@ -52,9 +46,9 @@ namespace LSGP4
      * Z position in km
      * W magnitude in km
      */
-        m_position.x = achcp * cos(theta);
-        m_position.y = achcp * sin(theta);
-        m_position.z = (kXKMPER * s + geo.altitude) * sin(geo.latitude);
+        m_position.x = station.position[0];
+        m_position.y = station.position[1];
+        m_position.z = station.position[2];
         m_position.w = m_position.Magnitude();
 
         /*
@@ -63,9 +57,9 @@ namespace LSGP4
      * Z velocity in km/s
      * W magnitude in km/s
      */
-        m_velocity.x = -mfactor * m_position.y;
-        m_velocity.y = mfactor * m_position.x;
-        m_velocity.z = 0.0;
+        m_velocity.x = station.velocity[0];
+        m_velocity.y = station.velocity[1];
+        m_velocity.z = station.velocity[2];
         m_velocity.w = m_velocity.Magnitude();
     }
 
@@ -100,4 +94,43 @@ namespace LSGP4
 
         return CoordGeodetic(lat, lon, alt, true);
     }
-};
\ No newline at end of file
+
+    void Eci::ToGeodetic(const Eci *eci, size_t n, CoordGeodetic *geodetic)
+    {
+        static const size_t kBlock = 256;
+        const NearSpaceKernel::Isa isa = NearSpaceKernel::BestIsa();
+
+        double x[kBlock];
+        double y[kBlock];
+        double z[kBlock];
+        double lat[kBlock];
+        double lon[kBlock];
+        double alt[kBlock];
+
+        size_t i = 0;
+        while (i < n)
+        {
+            /*
+             * a run of positions with the same date, up to a block
+             */
+            const DateTime &dt = eci[i].m_dt;
+            size_t count = 0;
+            while (i + count < n && count < kBlock && eci[i + count].m_dt == dt)
+            {
+                const Vector &position = eci[i + count].m_position;
+                x[count] = position.x;
+                y[count] = position.y;
+                z[count] = position.z;
+                count++;
+            }
+
+            CoordinateKernel::ToGeodetic(isa, dt.ToGreenwichSiderealTime(), x, y, z, count, lat, lon, alt);
+
+            for (size_t k = 0; k < count; k++)
+            {
+                geodetic[i + k] = CoordGeodetic(lat[k], lon[k], alt[k], true);
+            }
+            i += count;
+        }
+    }
+};
@@ -0,0 +1,434 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EphemerisInterpolator.hpp"
+
+#include "Globals.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+    /*
+     * terms of each Chebyshev series, degree kChebyshevTerms - 1
+     */
+    const size_t kChebyshevTerms = 12;
+
+    /*
+     * segments a period is first cut into
+     */
+    const double kHermiteSegmentsPerPeriod = 16.0;
+    const double kChebyshevSegmentsPerPeriod = 4.0;
+
+    /*
+     * segments are not halved below a second
+     */
+    const double kMinSegment = 1.0 / 60.0;
+
+    /*
+     * fractions of a Hermite segment the fit is checked at, middle first.
+     * the position error peaks at the middle, the velocity error about a
+     * fifth of the way in from each end, and both are smooth between
+     * checks an eighth apart
+     */
+    const double kHermiteChecks[] = {0.5, 0.25, 0.75, 0.125, 0.375, 0.625, 0.875};
+
+    /*
+     * the share of each tolerance the errors at the checks must be within,
+     * leaving the rest for the error between them
+     */
+    const double kCheckMargin = 0.9;
+
+    /*
+     * km/min to km/s
+     */
+    const double kPerSecond = 1.0 / 60.0;
+
+    /*
+     * position and velocity of the cubic Hermite polynomial through two
+     * states, at fraction s of a segment of length h
+     */
+    inline void EvaluateHermite(const double *a,
+                                const double *b,
+                                double h,
+                                double s,
+                                double *position,
+                                double *velocity)
+    {
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+
+        const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+        const double h10 = (s3 - 2.0 * s2 + s) * h;
+        const double h01 = 3.0 * s2 - 2.0 * s3;
+        const double h11 = (s3 - s2) * h;
+
+        const double d00 = (6.0 * s2 - 6.0 * s) / h;
+        const double d10 = 3.0 * s2 - 4.0 * s + 1.0;
+        const double d01 = -d00;
+        const double d11 = 3.0 * s2 - 2.0 * s;
+
+        for (int i = 0; i < 3; i++)
+        {
+            position[i] = h00 * a[i] + h10 * a[i + 3] + h01 * b[i] + h11 * b[i + 3];
+            velocity[i] = d00 * a[i] + d10 * a[i + 3] + d01 * b[i] + d11 * b[i + 3];
+        }
+    }
+
+    /*
+     * the six series of one segment at x in [-1, 1]. the Chebyshev
+     * polynomials at x are shared by the six, so they are found once, by
+     * T(2n) = 2T(n)^2 - 1 and T(2n + 1) = 2T(n)T(n + 1) - x in four steps
+     * rather than eleven of the three term recurrence, and each series is
+     * then two sums of independent products
+     */
+    inline void EvaluateChebyshev(const double *coefficients, double x, double *values)
+    {
+        double t[kChebyshevTerms];
+        t[0] = 1.0;
+        t[1] = x;
+        for (size_t k = 2; k < kChebyshevTerms; k++)
+        {
+            const size_t n = k / 2;
+            t[k] = k % 2 == 0 ? 2.0 * t[n] * t[n] - 1.0 : 2.0 * t[n] * t[n + 1] - x;
+        }
+
+        for (int i = 0; i < 6; i++)
+        {
+            double even = coefficients[i];
+            double odd = 0.0;
+            size_t k = 1;
+            for (; k + 1 < kChebyshevTerms; k += 2)
+            {
+                odd += coefficients[6 * k + i] * t[k];
+                even += coefficients[6 * (k + 1) + i] * t[k + 1];
+            }
+            if (k < kChebyshevTerms)
+            {
+                odd += coefficients[6 * k + i] * t[k];
+            }
+            values[i] = even + odd;
+        }
+    }
+
+    inline double Distance(const double *a, const double *b)
+    {
+        const double dx = a[0] - b[0];
+        const double dy = a[1] - b[1];
+        const double dz = a[2] - b[2];
+        return sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
+
+namespace LSGP4
+{
+    EphemerisInterpolator::EphemerisInterpolator(const SGP4 &sgp4,
+                                                 const DateTime &start,
+                                                 const DateTime &end,
+                                                 double tolerance,
+                                                 Method method,
+                                                 double velocity_tolerance)
+        : epoch_(sgp4.GetOrbitalElements().Epoch()),
+          start_(start),
+          end_(end),
+          tolerance_(tolerance),
+          velocity_tolerance_(velocity_tolerance),
+          method_(method),
+          evaluations_(0)
+    {
+        const double first = (start - epoch_).TotalMinutes();
+        const double last = std::max(first, (end - epoch_).TotalMinutes());
+        const double period = sgp4.GetOrbitalElements().Period();
+        const double per_period = method_ == HERMITE ? kHermiteSegmentsPerPeriod : kChebyshevSegmentsPerPeriod;
+        const size_t count = std::max<size_t>(1, static_cast<size_t>(ceil((last - first) * per_period / period)));
+
+        if (method_ == HERMITE)
+        {
+            double a[6];
+            double b[6];
+
+            Sample(sgp4, first, a);
+            bounds_.push_back(first);
+            data_.insert(data_.end(), a, a + 3);
+            for (int i = 3; i < 6; i++)
+            {
+                data_.push_back(a[i] * 60.0);
+            }
+
+            for (size_t i = 1; i <= count; i++)
+            {
+                const double t = i == count ? last : first + (last - first) * i / count;
+                Sample(sgp4, t, b);
+                RefineHermite(sgp4, bounds_.back(), a, t, b);
+                std::copy(b, b + 6, a);
+            }
+        }
+        else
+        {
+            bounds_.push_back(first);
+            for (size_t i = 1; i <= count; i++)
+            {
+                const double t = i == count ? last : first + (last - first) * i / count;
+                RefineChebyshev(sgp4, bounds_.back(), t);
+            }
+        }
+
+        /*
+         * a bin per segment, each holding the segment its start falls in
+         */
+        const size_t segments = SegmentCount();
+        bin_scale_ = last > first ? segments / (last - first) : 0.0;
+        bins_.resize(segments + 1);
+        for (size_t b = 0; b <= segments; b++)
+        {
+            const double t = b == segments ? last : first + (last - first) * b / segments;
+            const std::vector<double>::const_iterator it =
+                std::upper_bound(bounds_.begin() + 1, bounds_.end() - 1, t);
+            bins_[b] = static_cast<size_t>(it - bounds_.begin()) - 1;
+        }
+    }
+
+    void EphemerisInterpolator::Sample(const SGP4 &sgp4, double tsince, double *state)
+    {
+        const Eci eci = sgp4.FindPosition(tsince, integ_params_);
+        evaluations_++;
+
+        state[0] = eci.Position().x;
+        state[1] = eci.Position().y;
+        state[2] = eci.Position().z;
+        state[3] = eci.Velocity().x;
+        state[4] = eci.Velocity().y;
+        state[5] = eci.Velocity().z;
+    }
+
+    void EphemerisInterpolator::RefineHermite(const SGP4 &sgp4,
+                                              double first,
+                                              const double *first_state,
+                                              double last,
+                                              const double *last_state)
+    {
+        const double h = last - first;
+        const double middle = first + 0.5 * h;
+
+        double a[6];
+        double b[6];
+        for (int i = 0; i < 3; i++)
+        {
+            a[i] = first_state[i];
+            a[i + 3] = first_state[i + 3] * 60.0;
+            b[i] = last_state[i];
+            b[i + 3] = last_state[i + 3] * 60.0;
+        }
+
+        /*
+         * SGP4 velocities are not exactly the rate of change of its
+         * positions, and the derivative of the fit misses SGP4 by up to one
+         * and a half times the difference at the middle, falling to zero at
+         * the ends. the miss at the middle, spread as 4s(1 - s), corrects it
+         */
+        double mid[6];
+        Sample(sgp4, middle, mid);
+
+        double correction[3];
+        double position[3];
+        double velocity[3];
+        EvaluateHermite(a, b, h, 0.5, position, velocity);
+        for (int i = 0; i < 3; i++)
+        {
+            correction[i] = mid[i + 3] * 60.0 - velocity[i];
+        }
+
+        const size_t checks = sizeof(kHermiteChecks) / sizeof(kHermiteChecks[0]);
+        bool accept = h <= 2.0 * kMinSegment;
+        for (size_t k = 0; !accept && k < checks; k++)
+        {
+            const double fraction = kHermiteChecks[k];
+            double state[6];
+            if (fraction == 0.5)
+            {
+                std::copy(mid, mid + 6, state);
+            }
+            else
+            {
+                Sample(sgp4, first + fraction * h, state);
+            }
+
+            EvaluateHermite(a, b, h, fraction, position, velocity);
+            for (int i = 0; i < 3; i++)
+            {
+                velocity[i] = (velocity[i] + 4.0 * fraction * (1.0 - fraction) * correction[i]) / 60.0;
+            }
+            if (Distance(position, state) > kCheckMargin * tolerance_ ||
+                Distance(velocity, state + 3) > kCheckMargin * velocity_tolerance_)
+            {
+                break;
+            }
+            accept = k == checks - 1;
+        }
+
+        if (!accept)
+        {
+            RefineHermite(sgp4, first, first_state, middle, mid);
+            RefineHermite(sgp4, middle, mid, last, last_state);
+            return;
+        }
+
+        bounds_.push_back(last);
+        data_.insert(data_.end(), b, b + 6);
+        corrections_.insert(corrections_.end(), correction, correction + 3);
+    }
+
+    void EphemerisInterpolator::RefineChebyshev(const SGP4 &sgp4, double first, double last)
+    {
+        const size_t n = kChebyshevTerms;
+        const double centre = 0.5 * (first + last);
+        const double half = 0.5 * (last - first);
+
+        /*
+         * states at the Chebyshev nodes, then the coefficients by the
+         * discrete cosine transform
+         */
+        double states[kChebyshevTerms][6];
+        for (size_t k = 0; k < n; k++)
+        {
+            const double x = cos(kPI * (k + 0.5) / n);
+            Sample(sgp4, centre + half * x, states[k]);
+        }
+
+        double coefficients[kChebyshevTerms * 6];
+        for (size_t j = 0; j < n; j++)
+        {
+            double sum[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+            for (size_t k = 0; k < n; k++)
+            {
+                const double w = cos(kPI * j * (k + 0.5) / n);
+                for (int i = 0; i < 6; i++)
+                {
+                    sum[i] += w * states[k][i];
+                }
+            }
+            for (int i = 0; i < 6; i++)
+            {
+                coefficients[6 * j + i] = (j == 0 ? 1.0 : 2.0) * sum[i] / n;
+            }
+        }
+
+        /*
+         * a fit that has not converged shows in its last terms, and the
+         * error of one that has follows the next Chebyshev polynomial, so
+         * check the terms and then at the extrema of that polynomial
+         */
+        double tail[6];
+        for (int i = 0; i < 6; i++)
+        {
+            tail[i] = fabs(coefficients[6 * (n - 1) + i]) + fabs(coefficients[6 * (n - 2) + i]);
+        }
+        const double zero[3] = {0.0, 0.0, 0.0};
+
+        bool accept = last - first <= 2.0 * kMinSegment;
+        if (!accept && (Distance(tail, zero) > tolerance_ || Distance(tail + 3, zero) > velocity_tolerance_))
+        {
+            RefineChebyshev(sgp4, first, centre);
+            RefineChebyshev(sgp4, centre, last);
+            return;
+        }
+        for (size_t k = 0; !accept && k <= n; k++)
+        {
+            const double x = cos(kPI * k / n);
+            double state[6];
+            double values[6];
+            Sample(sgp4, centre + half * x, state);
+            EvaluateChebyshev(coefficients, x, values);
+            if (Distance(values, state) > kCheckMargin * tolerance_ ||
+                Distance(values + 3, state + 3) > kCheckMargin * velocity_tolerance_)
+            {
+                break;
+            }
+            accept = k == n;
+        }
+
+        if (!accept)
+        {
+            RefineChebyshev(sgp4, first, centre);
+            RefineChebyshev(sgp4, centre, last);
+            return;
+        }
+
+        bounds_.push_back(last);
+        data_.insert(data_.end(), coefficients, coefficients + 6 * n);
+    }
+
+    size_t EphemerisInterpolator::FindSegment(double tsince) const
+    {
+        if (!(tsince >= bounds_.front() && tsince <= bounds_.back()))
+        {
+            throw std::out_of_range("Time outside the interpolated span");
+        }
+
+        /*
+         * search only the segments of the bin tsince falls in, and one either
+         * side of them for a bin rounded the other way
+         */
+        const size_t bin = std::min(static_cast<size_t>((tsince - bounds_.front()) * bin_scale_),
+                                    bins_.size() - 2);
+        const size_t low = bins_[bin] > 0 ? bins_[bin] - 1 : 0;
+        const size_t high = std::min(bins_[bin + 1] + 1, bins_.size() - 2);
+
+        const double *bounds = bounds_.data();
+        return static_cast<size_t>(std::upper_bound(bounds + low + 1, bounds + high + 1, tsince) - bounds) - 1;
+    }
+
+    void EphemerisInterpolator::FindPosition(double tsince, Vector &position, Vector &velocity) const
+    {
+        const size_t i = FindSegment(tsince);
+        const double first = bounds_[i];
+        const double last = bounds_[i + 1];
+        const double *data = data_.data();
+
+        if (method_ == HERMITE)
+        {
+            const double h = last - first;
+            double p[3];
+            double v[3];
+            const double fraction = h > 0.0 ? (tsince - first) / h : 0.0;
+            EvaluateHermite(data + 6 * i, data + 6 * (i + 1), h, fraction, p, v);
+            const double spread = 4.0 * fraction * (1.0 - fraction);
+            const double *c = corrections_.data() + 3 * i;
+            position = Vector(p[0], p[1], p[2]);
+            velocity = Vector((v[0] + spread * c[0]) * kPerSecond,
+                              (v[1] + spread * c[1]) * kPerSecond,
+                              (v[2] + spread * c[2]) * kPerSecond);
+        }
+        else
+        {
+            const double x = last > first ? (2.0 * tsince - first - last) / (last - first) : 0.0;
+            double values[6];
+            EvaluateChebyshev(data + 6 * kChebyshevTerms * i, x, values);
+            position = Vector(values[0], values[1], values[2]);
+            velocity = Vector(values[3], values[4], values[5]);
+        }
+    }
+
+    Eci EphemerisInterpolator::FindPosition(const DateTime &dt) const
+    {
+        Vector position;
+        Vector velocity;
+        FindPosition((dt - epoch_).TotalMinutes(), position, velocity);
+        return Eci(dt, position, velocity);
+    }
+};
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MappedFile.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace LSGP4
+{
+    MappedFile::MappedFile(const char *fname)
+        : data_(NULL), size_(0)
+    {
+#ifdef _WIN32
+        file_ = NULL;
+        mapping_ = NULL;
+
+        HANDLE file = CreateFileA(fname, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        LARGE_INTEGER size;
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::invalid_argument("Could not access file");
+        }
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            throw std::invalid_argument("Could not access file");
+        }
+
+        file_ = file;
+        size_ = static_cast<size_t>(size.QuadPart);
+        if (size_ > 0)
+        {
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            const void *data = mapping == NULL ? NULL : MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (data == NULL)
+            {
+                if (mapping != NULL)
+                {
+                    CloseHandle(mapping);
+                }
+                CloseHandle(file);
+                throw std::invalid_argument("Could not access file");
+            }
+            mapping_ = mapping;
+            data_ = static_cast<const char *>(data);
+        }
+#else
+        const int fd = open(fname, O_RDONLY);
+        struct stat st;
+        if (fd < 0)
+        {
+            throw std::invalid_argument("Could not access file");
+        }
+        if (fstat(fd, &st) != 0)
+        {
+            close(fd);
+            throw std::invalid_argument("Could not access file");
+        }
+
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0)
+        {
+            void *data = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED)
+            {
+                close(fd);
+                throw std::invalid_argument("Could not access file");
+            }
+            data_ = static_cast<const char *>(data);
+        }
+
+        /*
+         * the mapping holds its own reference to the file
+         */
+        close(fd);
+#endif
+    }
+
+    MappedFile::~MappedFile()
+    {
+#ifdef _WIN32
+        if (data_ != NULL)
+        {
+            UnmapViewOfFile(data_);
+            CloseHandle(static_cast<HANDLE>(mapping_));
+        }
+        CloseHandle(static_cast<HANDLE>(file_));
+#else
+        if (data_ != NULL)
+        {
+            munmap(const_cast<char *>(data_), size_);
+        }
+#endif
+    }
+
+    void MappedFile::AdviseSequential() const
+    {
+#ifndef _WIN32
+        if (data_ != NULL)
+        {
+            madvise(const_cast<char *>(data_), size_, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    size_t MappedFile::Release(size_t begin, size_t end) const
+    {
+#ifdef _WIN32
+        (void)end;
+        return begin;
+#else
+        /*
+         * the pages are clean, so dropping them only means reading them
+         * again if they are touched
+         */
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t first = (begin + page - 1) / page * page;
+        const size_t last = end / page * page;
+
+        if (last <= first)
+        {
+            return begin;
+        }
+
+        madvise(const_cast<char *>(data_) + first, last - first, MADV_DONTNEED);
+        return last;
+#endif
+    }
+};
@@ -0,0 +1,984 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NearSpaceKernel.hpp"
+
+#include "SGP4.hpp"
+#include "SimdMath.hpp"
+
+#include <cfloat>
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NEARSPACEKERNEL_X86
+#endif
+
+namespace LSGP4
+{
+    namespace
+    {
+        /*
+         * the model for W objects at a time. every step is a loop over the
+         * lanes, so that each one compiles to a single vector operation.
+         */
+        template <int W>
+        SIMDMATH_INLINE void PropagateLanes(const double *c,
+                                            const size_t stride,
+                                            const double *tsince,
+                                            double out[6][W],
+                                            double status[W])
+        {
+            const double *xmo = c + NearSpaceKernel::XMO * stride;
+            const double *omegao = c + NearSpaceKernel::OMEGAO * stride;
+            const double *xnodeo = c + NearSpaceKernel::XNODEO * stride;
+            const double *xincl = c + NearSpaceKernel::XINCL * stride;
+            const double *eo = c + NearSpaceKernel::EO * stride;
+            const double *bstar = c + NearSpaceKernel::BSTAR * stride;
+            const double *aodp = c + NearSpaceKernel::AODP * stride;
+            const double *xnodp = c + NearSpaceKernel::XNODP * stride;
+            const double *cosio = c + NearSpaceKernel::COSIO * stride;
+            const double *sinio = c + NearSpaceKernel::SINIO * stride;
+            const double *eta = c + NearSpaceKernel::ETA * stride;
+            const double *t2cof = c + NearSpaceKernel::T2COF * stride;
+            const double *x1mth2 = c + NearSpaceKernel::X1MTH2 * stride;
+            const double *x3thm1 = c + NearSpaceKernel::X3THM1 * stride;
+            const double *x7thm1 = c + NearSpaceKernel::X7THM1 * stride;
+            const double *aycof = c + NearSpaceKernel::AYCOF * stride;
+            const double *xlcof = c + NearSpaceKernel::XLCOF * stride;
+            const double *xnodcf = c + NearSpaceKernel::XNODCF * stride;
+            const double *c1 = c + NearSpaceKernel::C1 * stride;
+            const double *c4 = c + NearSpaceKernel::C4 * stride;
+            const double *omgdot = c + NearSpaceKernel::OMGDOT * stride;
+            const double *xnodot = c + NearSpaceKernel::XNODOT * stride;
+            const double *xmdot = c + NearSpaceKernel::XMDOT * stride;
+            const double *c5 = c + NearSpaceKernel::C5 * stride;
+            const double *omgcof = c + NearSpaceKernel::OMGCOF * stride;
+            const double *xmcof = c + NearSpaceKernel::XMCOF * stride;
+            const double *delmo = c + NearSpaceKernel::DELMO * stride;
+            const double *sinmo = c + NearSpaceKernel::SINMO * stride;
+            const double *d2 = c + NearSpaceKernel::D2 * stride;
+            const double *d3 = c + NearSpaceKernel::D3 * stride;
+            const double *d4 = c + NearSpaceKernel::D4 * stride;
+            const double *t3cof = c + NearSpaceKernel::T3COF * stride;
+            const double *t4cof = c + NearSpaceKernel::T4COF * stride;
+            const double *t5cof = c + NearSpaceKernel::T5COF * stride;
+
+            double a[W];
+            double xnode[W];
+            double axn[W];
+            double ayn[W];
+            double capu[W];
+            double xn[W];
+            double elsq[W];
+            double max_newton_naphson[W];
+            double st[W];
+
+            /*
+             * secular gravity and atmospheric drag, long period periodics
+             */
+            for (int l = 0; l < W; l++)
+            {
+                const double t = tsince[l];
+                const double xmdf = xmo[l] + xmdot[l] * t;
+                const double omgadf = omegao[l] + omgdot[l] * t;
+                const double xnoddf = xnodeo[l] + xnodot[l] * t;
+
+                const double tsq = t * t;
+                xnode[l] = xnoddf + xnodcf[l] * tsq;
+
+                double sinxmdf;
+                double cosxmdf;
+                SimdMath::SinCos(xmdf, sinxmdf, cosxmdf);
+                const double base = 1.0 + eta[l] * cosxmdf;
+                const double delomg = omgcof[l] * t;
+                const double delm = xmcof[l] * (base * base * base - delmo[l]);
+                const double temp = delomg + delm;
+                const double xmp = xmdf + temp;
+                const double omega = omgadf - temp;
+
+                const double tcube = tsq * t;
+                const double tfour = t * tcube;
+
+                double sinxmp;
+                double cosxmp;
+                SimdMath::SinCos(xmp, sinxmp, cosxmp);
+                const double tempa = 1.0 - c1[l] * t - d2[l] * tsq - d3[l] * tcube - d4[l] * tfour;
+                const double tempe = bstar[l] * c4[l] * t + bstar[l] * c5[l] * (sinxmp - sinmo[l]);
+                const double templ = t2cof[l] * tsq + (t3cof[l] * tcube + tfour * (t4cof[l] + t * t5cof[l]));
+
+                a[l] = aodp[l] * tempa * tempa;
+                const double er = eo[l] - tempe;
+                const double xl = xmp + omega + xnode[l] + xnodp[l] * templ;
+
+                double s = er <= -0.001 ? SGP4::ECCENTRICITY : SGP4::OK;
+                double e = er < 1.0e-6 ? 1.0e-6 : er;
+                e = e > (1.0 - 1.0e-6) ? (1.0 - 1.0e-6) : e;
+
+                const double beta2 = 1.0 - e * e;
+                xn[l] = kXKE / (a[l] * sqrt(a[l]));
+
+                double sinomega;
+                double cosomega;
+                SimdMath::SinCos(omega, sinomega, cosomega);
+                axn[l] = e * cosomega;
+                const double temp11 = 1.0 / (a[l] * beta2);
+                const double xll = temp11 * xlcof[l] * axn[l];
+                const double aynl = temp11 * aycof[l];
+                const double xlt = xl + xll;
+                ayn[l] = e * sinomega + aynl;
+                elsq[l] = axn[l] * axn[l] + ayn[l] * ayn[l];
+
+                s = s == SGP4::OK ? (elsq[l] >= 1.0 ? SGP4::ELSQ : SGP4::OK) : s;
+                st[l] = s;
+
+                capu[l] = SimdMath::WrapNegPosPI(xlt - xnode[l]);
+                max_newton_naphson[l] = 1.25 * sqrt(elsq[l]);
+            }
+
+            /*
+             * solve keplers equation. converged lanes keep their values, and
+             * the iteration ends once every lane has converged
+             */
+            double epw[W];
+            double sinepw[W];
+            double cosepw[W];
+            double ecose[W];
+            double esine[W];
+            double running[W];
+
+            for (int l = 0; l < W; l++)
+            {
+                epw[l] = capu[l];
+                sinepw[l] = 0.0;
+                cosepw[l] = 0.0;
+                ecose[l] = 0.0;
+                esine[l] = 0.0;
+                running[l] = 1.0;
+            }
+
+            for (int i = 0; i < 10; i++)
+            {
+                /*
+                 * a limited 1st order correction on the first iteration, 2nd
+                 * order afterwards
+                 */
+                const double order2 = i == 0 ? 0.0 : 0.5;
+
+                for (int l = 0; l < W; l++)
+                {
+                    double s;
+                    double co;
+                    SimdMath::SinCos(epw[l], s, co);
+                    const double ec = axn[l] * co + ayn[l] * s;
+                    const double es = axn[l] * s - ayn[l] * co;
+                    const double f = capu[l] - epw[l] + es;
+                    const bool run = running[l] != 0.0;
+                    const bool next = run & !(fabs(f) < 1.0e-12);
+
+                    const double fdot = 1.0 - ec;
+                    double delta_epw = f / (fdot + order2 * es * (f / fdot));
+                    delta_epw = delta_epw > max_newton_naphson[l] ? max_newton_naphson[l] : delta_epw;
+                    delta_epw = delta_epw < -max_newton_naphson[l] ? -max_newton_naphson[l] : delta_epw;
+                    max_newton_naphson[l] = DBL_MAX;
+
+                    sinepw[l] = run ? s : sinepw[l];
+                    cosepw[l] = run ? co : cosepw[l];
+                    ecose[l] = run ? ec : ecose[l];
+                    esine[l] = run ? es : esine[l];
+                    epw[l] = next ? epw[l] + delta_epw : epw[l];
+                    running[l] = next ? 1.0 : 0.0;
+                }
+
+                bool any_running = false;
+                for (int l = 0; l < W; l++)
+                {
+                    any_running |= running[l] != 0.0;
+                }
+                if (!any_running)
+                {
+                    break;
+                }
+            }
+
+            /*
+             * short period periodics, orientation vectors, position and velocity
+             */
+            for (int l = 0; l < W; l++)
+            {
+                const double temp21 = 1.0 - elsq[l];
+                const double pl = a[l] * temp21;
+                double s = st[l];
+                s = s == SGP4::OK ? (pl < 0.0 ? SGP4::SEMI_LATUS_RECTUM : SGP4::OK) : s;
+
+                const double r = a[l] * (1.0 - ecose[l]);
+                const double temp31 = 1.0 / r;
+                const double rdot = kXKE * sqrt(a[l]) * esine[l] * temp31;
+                const double rfdot = kXKE * sqrt(pl) * temp31;
+                const double temp32 = a[l] * temp31;
+                const double betal = sqrt(temp21);
+                const double temp33 = 1.0 / (1.0 + betal);
+                const double cosu = temp32 * (cosepw[l] - axn[l] + ayn[l] * esine[l] * temp33);
+                const double sinu = temp32 * (sinepw[l] - ayn[l] - axn[l] * esine[l] * temp33);
+                const double u = SimdMath::Atan2(sinu, cosu);
+                const double sin2u = 2.0 * sinu * cosu;
+                const double cos2u = 2.0 * cosu * cosu - 1.0;
+
+                const double temp41 = 1.0 / pl;
+                const double temp42 = kCK2 * temp41;
+                const double temp43 = temp42 * temp41;
+
+                const double rk = r * (1.0 - 1.5 * temp43 * betal * x3thm1[l]) + 0.5 * temp42 * x1mth2[l] * cos2u;
+                const double uk = u - 0.25 * temp43 * x7thm1[l] * sin2u;
+                const double xnodek = xnode[l] + 1.5 * temp43 * cosio[l] * sin2u;
+                const double xinck = xincl[l] + 1.5 * temp43 * cosio[l] * sinio[l] * cos2u;
+                const double rdotk = rdot - xn[l] * temp42 * x1mth2[l] * sin2u;
+                const double rfdotk = rfdot + xn[l] * temp42 * (x1mth2[l] * cos2u + 1.5 * x3thm1[l]);
+
+                double sinuk;
+                double cosuk;
+                double sinik;
+                double cosik;
+                double sinnok;
+                double cosnok;
+                SimdMath::SinCos(uk, sinuk, cosuk);
+                SimdMath::SinCos(xinck, sinik, cosik);
+                SimdMath::SinCos(xnodek, sinnok, cosnok);
+                const double xmx = -sinnok * cosik;
+                const double xmy = cosnok * cosik;
+                const double ux = xmx * sinuk + cosnok * cosuk;
+                const double uy = xmy * sinuk + sinnok * cosuk;
+                const double uz = sinik * sinuk;
+                const double vx = xmx * cosuk - cosnok * sinuk;
+                const double vy = xmy * cosuk - sinnok * sinuk;
+                const double vz = sinik * cosuk;
+
+                s = s == SGP4::OK ? (rk < 1.0 ? SGP4::DECAYED : SGP4::OK) : s;
+                const bool failed = s == SGP4::DECAYED ? false : s != SGP4::OK;
+
+                out[0][l] = failed ? 0.0 : rk * ux * kXKMPER;
+                out[1][l] = failed ? 0.0 : rk * uy * kXKMPER;
+                out[2][l] = failed ? 0.0 : rk * uz * kXKMPER;
+                out[3][l] = failed ? 0.0 : (rdotk * ux + rfdotk * vx) * kXKMPER / 60.0;
+                out[4][l] = failed ? 0.0 : (rdotk * uy + rfdotk * vy) * kXKMPER / 60.0;
+                out[5][l] = failed ? 0.0 : (rdotk * uz + rfdotk * vz) * kXKMPER / 60.0;
+                status[l] = s;
+            }
+        }
+
+        /*
+         * whole blocks of W objects straight from the columns, the remainder
+         * from a padded copy
+         */
+        template <int W>
+        SIMDMATH_INLINE void PropagateBlocks(const double *consts,
+                                             const size_t stride,
+                                             const double *tsince,
+                                             const size_t n,
+                                             const size_t *index,
+                                             Vector *positions,
+                                             Vector *velocities,
+                                             unsigned char *status)
+        {
+            double out[6][W];
+            double st[W];
+
+            for (size_t i = 0; i < n; i += W)
+            {
+                size_t lanes = W;
+
+                if (i + W <= n)
+                {
+                    PropagateLanes<W>(consts + i, stride, tsince + i, out, st);
+                }
+                else
+                {
+                    lanes = n - i;
+
+                    double tail[NearSpaceKernel::FIELD_COUNT * W];
+                    double tail_tsince[W];
+                    for (int l = 0; l < W; l++)
+                    {
+                        const size_t src = i + (static_cast<size_t>(l) < lanes ? l : lanes - 1);
+                        for (int f = 0; f < NearSpaceKernel::FIELD_COUNT; f++)
+                        {
+                            tail[f * W + l] = consts[f * stride + src];
+                        }
+                        tail_tsince[l] = tsince[src];
+                    }
+
+                    PropagateLanes<W>(tail, W, tail_tsince, out, st);
+                }
+
+                for (size_t l = 0; l < lanes; l++)
+                {
+                    const size_t dst = index ? index[i + l] : i + l;
+                    positions[dst] = Vector(out[0][l], out[1][l], out[2][l]);
+                    velocities[dst] = Vector(out[3][l], out[4][l], out[5][l]);
+                    status[dst] = static_cast<unsigned char>(st[l]);
+                }
+            }
+        }
+
+#ifdef NEARSPACEKERNEL_X86
+        __attribute__((target("avx512f"))) void PropagateAvx512(const double *consts,
+                                                                const size_t stride,
+                                                                const double *tsince,
+                                                                const size_t n,
+                                                                const size_t *index,
+                                                                Vector *positions,
+                                                                Vector *velocities,
+                                                                unsigned char *status)
+        {
+            PropagateBlocks<8>(consts, stride, tsince, n, index, positions, velocities, status);
+        }
+
+        __attribute__((target("avx2"))) void PropagateAvx2(const double *consts,
+                                                           const size_t stride,
+                                                           const double *tsince,
+                                                           const size_t n,
+                                                           const size_t *index,
+                                                           Vector *positions,
+                                                           Vector *velocities,
+                                                           unsigned char *status)
+        {
+            PropagateBlocks<4>(consts, stride, tsince, n, index, positions, velocities, status);
+        }
+#endif
+
+        /*
+         * the baseline instruction set of the target, SSE2 on x86-64
+         */
+        void PropagateSse2(const double *consts,
+                           const size_t stride,
+                           const double *tsince,
+                           const size_t n,
+                           const size_t *index,
+                           Vector *positions,
+                           Vector *velocities,
+                           unsigned char *status)
+        {
+            PropagateBlocks<4>(consts, stride, tsince, n, index, positions, velocities, status);
+        }
+
+        /*
+         * the model for W objects at a time in single precision. the
+         * secular angles grow by hundreds of radians a week, more than a
+         * float resolves, so they are advanced and reduced to [-pi, pi] in
+         * double before everything else runs in float.
+         */
+        template <int W>
+        SIMDMATH_INLINE void PropagateLanesFloat(const double *c,
+                                                 const size_t stride,
+                                                 const double *tsince,
+                                                 float out[6][W],
+                                                 float status[W])
+        {
+            const double *xmo = c + NearSpaceKernel::XMO * stride;
+            const double *omegao = c + NearSpaceKernel::OMEGAO * stride;
+            const double *xnodeo = c + NearSpaceKernel::XNODEO * stride;
+            const double *xnodp = c + NearSpaceKernel::XNODP * stride;
+            const double *t2cof = c + NearSpaceKernel::T2COF * stride;
+            const double *xnodcf = c + NearSpaceKernel::XNODCF * stride;
+            const double *omgdot = c + NearSpaceKernel::OMGDOT * stride;
+            const double *xnodot = c + NearSpaceKernel::XNODOT * stride;
+            const double *xmdot = c + NearSpaceKernel::XMDOT * stride;
+            const double *t3cof = c + NearSpaceKernel::T3COF * stride;
+            const double *t4cof = c + NearSpaceKernel::T4COF * stride;
+            const double *t5cof = c + NearSpaceKernel::T5COF * stride;
+
+            float t[W];
+            float xmdf[W];
+            float omgadf[W];
+            float xnode[W];
+            float drift[W];
+
+            for (int l = 0; l < W; l++)
+            {
+                const double td = tsince[l];
+                const double tsq = td * td;
+                const double tcube = tsq * td;
+                const double tfour = td * tcube;
+                const double templ = t2cof[l] * tsq + (t3cof[l] * tcube + tfour * (t4cof[l] + td * t5cof[l]));
+
+                t[l] = static_cast<float>(td);
+                xmdf[l] = static_cast<float>(SimdMath::WrapNegPosPI(xmo[l] + xmdot[l] * td));
+                omgadf[l] = static_cast<float>(SimdMath::WrapNegPosPI(omegao[l] + omgdot[l] * td));
+                xnode[l] = static_cast<float>(SimdMath::WrapNegPosPI(xnodeo[l] + xnodot[l] * td + xnodcf[l] * tsq));
+                drift[l] = static_cast<float>(SimdMath::WrapNegPosPI(xnodp[l] * templ));
+            }
+
+            float k[NearSpaceKernel::FIELD_COUNT][W];
+            for (int f = 0; f < NearSpaceKernel::FIELD_COUNT; f++)
+            {
+                for (int l = 0; l < W; l++)
+                {
+                    k[f][l] = static_cast<float>(c[f * stride + l]);
+                }
+            }
+
+            const float *xincl = k[NearSpaceKernel::XINCL];
+            const float *eo = k[NearSpaceKernel::EO];
+            const float *bstar = k[NearSpaceKernel::BSTAR];
+            const float *aodp = k[NearSpaceKernel::AODP];
+            const float *cosio = k[NearSpaceKernel::COSIO];
+            const float *sinio = k[NearSpaceKernel::SINIO];
+            const float *eta = k[NearSpaceKernel::ETA];
+            const float *x1mth2 = k[NearSpaceKernel::X1MTH2];
+            const float *x3thm1 = k[NearSpaceKernel::X3THM1];
+            const float *x7thm1 = k[NearSpaceKernel::X7THM1];
+            const float *aycof = k[NearSpaceKernel::AYCOF];
+            const float *xlcof = k[NearSpaceKernel::XLCOF];
+            const float *c1 = k[NearSpaceKernel::C1];
+            const float *c4 = k[NearSpaceKernel::C4];
+            const float *c5 = k[NearSpaceKernel::C5];
+            const float *omgcof = k[NearSpaceKernel::OMGCOF];
+            const float *xmcof = k[NearSpaceKernel::XMCOF];
+            const float *delmo = k[NearSpaceKernel::DELMO];
+            const float *sinmo = k[NearSpaceKernel::SINMO];
+            const float *d2 = k[NearSpaceKernel::D2];
+            const float *d3 = k[NearSpaceKernel::D3];
+            const float *d4 = k[NearSpaceKernel::D4];
+
+            const float xke = static_cast<float>(kXKE);
+            const float ck2 = static_cast<float>(kCK2);
+            const float xkmper = static_cast<float>(kXKMPER);
+
+            float a[W];
+            float axn[W];
+            float ayn[W];
+            float capu[W];
+            float xn[W];
+            float elsq[W];
+            float max_newton_naphson[W];
+            float st[W];
+
+            /*
+             * secular gravity and atmospheric drag, long period periodics
+             */
+            for (int l = 0; l < W; l++)
+            {
+                const float tl = t[l];
+                const float tsq = tl * tl;
+
+                float sinxmdf;
+                float cosxmdf;
+                SimdMath::SinCos(xmdf[l], sinxmdf, cosxmdf);
+                const float base = 1.0f + eta[l] * cosxmdf;
+                const float delomg = omgcof[l] * tl;
+                const float delm = xmcof[l] * (base * base * base - delmo[l]);
+                const float temp = delomg + delm;
+                const float xmp = xmdf[l] + temp;
+                const float omega = omgadf[l] - temp;
+
+                const float tcube = tsq * tl;
+                const float tfour = tl * tcube;
+
+                float sinxmp;
+                float cosxmp;
+                SimdMath::SinCos(xmp, sinxmp, cosxmp);
+                const float tempa = 1.0f - c1[l] * tl - d2[l] * tsq - d3[l] * tcube - d4[l] * tfour;
+                const float tempe = bstar[l] * c4[l] * tl + bstar[l] * c5[l] * (sinxmp - sinmo[l]);
+
+                a[l] = aodp[l] * tempa * tempa;
+                const float er = eo[l] - tempe;
+                const float xl = xmp + omega + xnode[l] + drift[l];
+
+                float s = er <= -0.001f ? SGP4::ECCENTRICITY : SGP4::OK;
+                float e = er < 1.0e-6f ? 1.0e-6f : er;
+                e = e > (1.0f - 1.0e-6f) ? (1.0f - 1.0e-6f) : e;
+
+                const float beta2 = 1.0f - e * e;
+                xn[l] = xke / (a[l] * sqrtf(a[l]));
+
+                float sinomega;
+                float cosomega;
+                SimdMath::SinCos(omega, sinomega, cosomega);
+                axn[l] = e * cosomega;
+                const float temp11 = 1.0f / (a[l] * beta2);
+                const float xll = temp11 * xlcof[l] * axn[l];
+                const float aynl = temp11 * aycof[l];
+                const float xlt = xl + xll;
+                ayn[l] = e * sinomega + aynl;
+                elsq[l] = axn[l] * axn[l] + ayn[l] * ayn[l];
+
+                s = s == SGP4::OK ? (elsq[l] >= 1.0f ? SGP4::ELSQ : SGP4::OK) : s;
+                st[l] = s;
+
+                capu[l] = SimdMath::WrapNegPosPI(xlt - xnode[l]);
+                max_newton_naphson[l] = 1.25f * sqrtf(elsq[l]);
+            }
+
+            /*
+             * solve keplers equation to the resolution of a float
+             */
+            float epw[W];
+            float sinepw[W];
+            float cosepw[W];
+            float ecose[W];
+            float esine[W];
+            float running[W];
+
+            for (int l = 0; l < W; l++)
+            {
+                epw[l] = capu[l];
+                sinepw[l] = 0.0f;
+                cosepw[l] = 0.0f;
+                ecose[l] = 0.0f;
+                esine[l] = 0.0f;
+                running[l] = 1.0f;
+            }
+
+            for (int i = 0; i < 10; i++)
+            {
+                const float order2 = i == 0 ? 0.0f : 0.5f;
+
+                for (int l = 0; l < W; l++)
+                {
+                    float s;
+                    float co;
+                    SimdMath::SinCos(epw[l], s, co);
+                    const float ec = axn[l] * co + ayn[l] * s;
+                    const float es = axn[l] * s - ayn[l] * co;
+                    const float f = capu[l] - epw[l] + es;
+                    const bool run = running[l] != 0.0f;
+                    const bool next = run & !((f < 0.0f ? -f : f) < 1.0e-6f);
+
+                    const float fdot = 1.0f - ec;
+                    float delta_epw = f / (fdot + order2 * es * (f / fdot));
+                    delta_epw = delta_epw > max_newton_naphson[l] ? max_newton_naphson[l] : delta_epw;
+                    delta_epw = delta_epw < -max_newton_naphson[l] ? -max_newton_naphson[l] : delta_epw;
+                    max_newton_naphson[l] = FLT_MAX;
+
+                    sinepw[l] = run ? s : sinepw[l];
+                    cosepw[l] = run ? co : cosepw[l];
+                    ecose[l] = run ? ec : ecose[l];
+                    esine[l] = run ? es : esine[l];
+                    epw[l] = next ? epw[l] + delta_epw : epw[l];
+                    running[l] = next ? 1.0f : 0.0f;
+                }
+
+                bool any_running = false;
+                for (int l = 0; l < W; l++)
+                {
+                    any_running |= running[l] != 0.0f;
+                }
+                if (!any_running)
+                {
+                    break;
+                }
+            }
+
+            /*
+             * short period periodics, orientation vectors, position and velocity
+             */
+            for (int l = 0; l < W; l++)
+            {
+                const float temp21 = 1.0f - elsq[l];
+                const float pl = a[l] * temp21;
+                float s = st[l];
+                s = s == SGP4::OK ? (pl < 0.0f ? SGP4::SEMI_LATUS_RECTUM : SGP4::OK) : s;
+
+                const float r = a[l] * (1.0f - ecose[l]);
+                const float temp31 = 1.0f / r;
+                const float rdot = xke * sqrtf(a[l]) * esine[l] * temp31;
+                const float rfdot = xke * sqrtf(pl) * temp31;
+                const float temp32 = a[l] * temp31;
+                const float betal = sqrtf(temp21);
+                const float temp33 = 1.0f / (1.0f + betal);
+                const float cosu = temp32 * (cosepw[l] - axn[l] + ayn[l] * esine[l] * temp33);
+                const float sinu = temp32 * (sinepw[l] - ayn[l] - axn[l] * esine[l] * temp33);
+                const float u = SimdMath::Atan2(sinu, cosu);
+                const float sin2u = 2.0f * sinu * cosu;
+                const float cos2u = 2.0f * cosu * cosu - 1.0f;
+
+                const float temp41 = 1.0f / pl;
+                const float temp42 = ck2 * temp41;
+                const float temp43 = temp42 * temp41;
+
+                const float rk = r * (1.0f - 1.5f * temp43 * betal * x3thm1[l]) + 0.5f * temp42 * x1mth2[l] * cos2u;
+                const float uk = u - 0.25f * temp43 * x7thm1[l] * sin2u;
+                const float xnodek = xnode[l] + 1.5f * temp43 * cosio[l] * sin2u;
+                const float xinck = xincl[l] + 1.5f * temp43 * cosio[l] * sinio[l] * cos2u;
+                const float rdotk = rdot - xn[l] * temp42 * x1mth2[l] * sin2u;
+                const float rfdotk = rfdot + xn[l] * temp42 * (x1mth2[l] * cos2u + 1.5f * x3thm1[l]);
+
+                float sinuk;
+                float cosuk;
+                float sinik;
+                float cosik;
+                float sinnok;
+                float cosnok;
+                SimdMath::SinCos(uk, sinuk, cosuk);
+                SimdMath::SinCos(xinck, sinik, cosik);
+                SimdMath::SinCos(xnodek, sinnok, cosnok);
+                const float xmx = -sinnok * cosik;
+                const float xmy = cosnok * cosik;
+                const float ux = xmx * sinuk + cosnok * cosuk;
+                const float uy = xmy * sinuk + sinnok * cosuk;
+                const float uz = sinik * sinuk;
+                const float vx = xmx * cosuk - cosnok * sinuk;
+                const float vy = xmy * cosuk - sinnok * sinuk;
+                const float vz = sinik * cosuk;
+
+                s = s == SGP4::OK ? (rk < 1.0f ? SGP4::DECAYED : SGP4::OK) : s;
+                const bool failed = s == SGP4::DECAYED ? false : s != SGP4::OK;
+
+                out[0][l] = failed ? 0.0f : rk * ux * xkmper;
+                out[1][l] = failed ? 0.0f : rk * uy * xkmper;
+                out[2][l] = failed ? 0.0f : rk * uz * xkmper;
+                out[3][l] = failed ? 0.0f : (rdotk * ux + rfdotk * vx) * (xkmper / 60.0f);
+                out[4][l] = failed ? 0.0f : (rdotk * uy + rfdotk * vy) * (xkmper / 60.0f);
+                out[5][l] = failed ? 0.0f : (rdotk * uz + rfdotk * vz) * (xkmper / 60.0f);
+                status[l] = s;
+            }
+        }
+
+        /*
+         * as PropagateBlocks(), in single precision
+         */
+        template <int W>
+        SIMDMATH_INLINE void PropagateBlocksFloat(const double *consts,
+                                                  const size_t stride,
+                                                  const double *tsince,
+                                                  const size_t n,
+                                                  const size_t *index,
+                                                  Vector *positions,
+                                                  Vector *velocities,
+                                                  unsigned char *status)
+        {
+            float out[6][W];
+            float st[W];
+
+            for (size_t i = 0; i < n; i += W)
+            {
+                size_t lanes = W;
+
+                if (i + W <= n)
+                {
+                    PropagateLanesFloat<W>(consts + i, stride, tsince + i, out, st);
+                }
+                else
+                {
+                    lanes = n - i;
+
+                    double tail[NearSpaceKernel::FIELD_COUNT * W];
+                    double tail_tsince[W];
+                    for (int l = 0; l < W; l++)
+                    {
+                        const size_t src = i + (static_cast<size_t>(l) < lanes ? l : lanes - 1);
+                        for (int f = 0; f < NearSpaceKernel::FIELD_COUNT; f++)
+                        {
+                            tail[f * W + l] = consts[f * stride + src];
+                        }
+                        tail_tsince[l] = tsince[src];
+                    }
+
+                    PropagateLanesFloat<W>(tail, W, tail_tsince, out, st);
+                }
+
+                for (size_t l = 0; l < lanes; l++)
+                {
+                    const size_t dst = index ? index[i + l] : i + l;
+                    positions[dst] = Vector(out[0][l], out[1][l], out[2][l]);
+                    velocities[dst] = Vector(out[3][l], out[4][l], out[5][l]);
+                    status[dst] = static_cast<unsigned char>(st[l]);
+                }
+            }
+        }
+
+#ifdef NEARSPACEKERNEL_X86
+        __attribute__((target("avx512f"))) void PropagateFloatAvx512(const double *consts,
+                                                                     const size_t stride,
+                                                                     const double *tsince,
+                                                                     const size_t n,
+                                                                     const size_t *index,
+                                                                     Vector *positions,
+                                                                     Vector *velocities,
+                                                                     unsigned char *status)
+        {
+            PropagateBlocksFloat<16>(consts, stride, tsince, n, index, positions, velocities, status);
+        }
+
+        __attribute__((target("avx2"))) void PropagateFloatAvx2(const double *consts,
+                                                                const size_t stride,
+                                                                const double *tsince,
+                                                                const size_t n,
+                                                                const size_t *index,
+                                                                Vector *positions,
+                                                                Vector *velocities,
+                                                                unsigned char *status)
+        {
+            PropagateBlocksFloat<8>(consts, stride, tsince, n, index, positions, velocities, status);
+        }
+#endif
+
+        void PropagateFloatSse2(const double *consts,
+                                const size_t stride,
+                                const double *tsince,
+                                const size_t n,
+                                const size_t *index,
+                                Vector *positions,
+                                Vector *velocities,
+                                unsigned char *status)
+        {
+            PropagateBlocksFloat<8>(consts, stride, tsince, n, index, positions, velocities, status);
+        }
+
+        void PropagateFloatScalar(const double *consts,
+                                  const size_t stride,
+                                  const double *tsince,
+                                  const size_t n,
+                                  const size_t *index,
+                                  Vector *positions,
+                                  Vector *velocities,
+                                  unsigned char *status)
+        {
+            PropagateBlocksFloat<1>(consts, stride, tsince, n, index, positions, velocities, status);
+        }
+
+        NearSpaceKernel::Isa DetectIsa()
+        {
+#ifdef NEARSPACEKERNEL_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f"))
+            {
+                return NearSpaceKernel::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return NearSpaceKernel::AVX2;
+            }
+#endif
+            return NearSpaceKernel::SSE2;
+        }
+    }
+
+    NearSpaceKernel::Isa NearSpaceKernel::BestIsa()
+    {
+        static const Isa best = DetectIsa();
+        return best;
+    }
+
+    bool NearSpaceKernel::IsSupported(Isa isa)
+    {
+        return isa <= BestIsa();
+    }
+
+    const char *NearSpaceKernel::IsaName(Isa isa)
+    {
+        switch (isa)
+        {
+        case SCALAR:
+            return "scalar";
+        case SSE2:
+#ifdef NEARSPACEKERNEL_X86
+            return "sse2";
+#else
+            return "generic";
+#endif
+        case AVX2:
+            return "avx2";
+        case AVX512:
+            return "avx512";
+        }
+        return "unknown";
+    }
+
+    void NearSpaceKernel::Pack(const SGP4 &sgp4, double *consts, size_t stride, size_t slot)
+    {
+        const OrbitalElements &elements = sgp4.elements_;
+        const SGP4::CommonConstants &common = sgp4.common_consts_;
+        const SGP4::NearSpaceConstants &nearspace = sgp4.nearspace_consts_;
+        double *c = consts + slot;
+
+        c[XMO * stride] = elements.MeanAnomoly();
+        c[OMEGAO * stride] = elements.ArgumentPerigee();
+        c[XNODEO * stride] = elements.AscendingNode();
+        c[XINCL * stride] = elements.Inclination();
+        c[EO * stride] = elements.Eccentricity();
+        c[BSTAR * stride] = elements.BStar();
+        c[AODP * stride] = elements.RecoveredSemiMajorAxis();
+        c[XNODP * stride] = elements.RecoveredMeanMotion();
+
+        c[COSIO * stride] = common.cosio;
+        c[SINIO * stride] = common.sinio;
+        c[ETA * stride] = common.eta;
+        c[T2COF * stride] = common.t2cof;
+        c[X1MTH2 * stride] = common.x1mth2;
+        c[X3THM1 * stride] = common.x3thm1;
+        c[X7THM1 * stride] = common.x7thm1;
+        c[AYCOF * stride] = common.aycof;
+        c[XLCOF * stride] = common.xlcof;
+        c[XNODCF * stride] = common.xnodcf;
+        c[C1 * stride] = common.c1;
+        c[C4 * stride] = common.c4;
+        c[OMGDOT * stride] = common.omgdot;
+        c[XNODOT * stride] = common.xnodot;
+        c[XMDOT * stride] = common.xmdot;
+
+        /*
+         * with these terms zeroed the full model reduces exactly to the
+         * simple model (d2 - t5cof are already zero)
+         */
+        const bool simple = sgp4.use_simple_model_;
+        c[C5 * stride] = simple ? 0.0 : nearspace.c5;
+        c[OMGCOF * stride] = simple ? 0.0 : nearspace.omgcof;
+        c[XMCOF * stride] = simple ? 0.0 : nearspace.xmcof;
+        c[DELMO * stride] = nearspace.delmo;
+        c[SINMO * stride] = nearspace.sinmo;
+        c[D2 * stride] = nearspace.d2;
+        c[D3 * stride] = nearspace.d3;
+        c[D4 * stride] = nearspace.d4;
+        c[T3COF * stride] = nearspace.t3cof;
+        c[T4COF * stride] = nearspace.t4cof;
+        c[T5COF * stride] = nearspace.t5cof;
+    }
+
+    void NearSpaceKernel::Propagate(Isa isa,
+                                    const double *consts,
+                                    size_t stride,
+                                    const double *tsince,
+                                    size_t n,
+                                    const size_t *index,
+                                    Vector *positions,
+                                    Vector *velocities,
+                                    unsigned char *status)
+    {
+        switch (isa)
+        {
+#ifdef NEARSPACEKERNEL_X86
+        case AVX512:
+            PropagateAvx512(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+        case AVX2:
+            PropagateAvx2(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+#endif
+        case SSE2:
+            PropagateSse2(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+        default:
+            PropagateScalar(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+        }
+    }
+
+    void NearSpaceKernel::PropagateFloat(Isa isa,
+                                         const double *consts,
+                                         size_t stride,
+                                         const double *tsince,
+                                         size_t n,
+                                         const size_t *index,
+                                         Vector *positions,
+                                         Vector *velocities,
+                                         unsigned char *status)
+    {
+        switch (isa)
+        {
+#ifdef NEARSPACEKERNEL_X86
+        case AVX512:
+            PropagateFloatAvx512(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+        case AVX2:
+            PropagateFloatAvx2(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+#endif
+        case SSE2:
+            PropagateFloatSse2(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+        default:
+            PropagateFloatScalar(consts, stride, tsince, n, index, positions, velocities, status);
+            break;
+        }
+    }
+
+    void NearSpaceKernel::PropagateScalar(const double *c,
+                                          size_t stride,
+                                          const double *tsince,
+                                          size_t n,
+                                          const size_t *index,
+                                          Vector *positions,
+                                          Vector *velocities,
+                                          unsigned char *status)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t out = index ? index[i] : i;
+            const double t = tsince[i];
+            const double *ci = c + i;
+
+            /*
+             * secular gravity and atmospheric drag, as SGP4::FindPositionSGP4()
+             */
+            const double xmdf = ci[XMO * stride] + ci[XMDOT * stride] * t;
+            const double omgadf = ci[OMEGAO * stride] + ci[OMGDOT * stride] * t;
+            const double xnoddf = ci[XNODEO * stride] + ci[XNODOT * stride] * t;
+
+            const double tsq = t * t;
+            const double xnode = xnoddf + ci[XNODCF * stride] * tsq;
+
+            const double delomg = ci[OMGCOF * stride] * t;
+            const double delm = ci[XMCOF * stride] * (pow(1.0 + ci[ETA * stride] * cos(xmdf), 3.0) - ci[DELMO * stride]);
+            const double temp = delomg + delm;
+            const double xmp = xmdf + temp;
+            const double omega = omgadf - temp;
+
+            const double tcube = tsq * t;
+            const double tfour = t * tcube;
+
+            const double tempa = 1.0 - ci[C1 * stride] * t - ci[D2 * stride] * tsq - ci[D3 * stride] * tcube - ci[D4 * stride] * tfour;
+            const double tempe = ci[BSTAR * stride] * ci[C4 * stride] * t + ci[BSTAR * stride] * ci[C5 * stride] * (sin(xmp) - ci[SINMO * stride]);
+            const double templ = ci[T2COF * stride] * tsq + (ci[T3COF * stride] * tcube + tfour * (ci[T4COF * stride] + t * ci[T5COF * stride]));
+
+            const double a = ci[AODP * stride] * tempa * tempa;
+            double e = ci[EO * stride] - tempe;
+            const double xl = xmp + omega + xnode + ci[XNODP * stride] * templ;
+
+            if (e <= -0.001)
+            {
+                positions[out] = Vector();
+                velocities[out] = Vector();
+                status[out] = SGP4::ECCENTRICITY;
+                continue;
+            }
+
+            if (e < 1.0e-6)
+            {
+                e = 1.0e-6;
+            }
+            else if (e > (1.0 - 1.0e-6))
+            {
+                e = 1.0 - 1.0e-6;
+            }
+
+            status[out] = SGP4::CalculateFinalPositionVelocity(e,
+                                                               a,
+                                                               omega,
+                                                               xl,
+                                                               xnode,
+                                                               ci[XINCL * stride],
+                                                               ci[XLCOF * stride],
+                                                               ci[AYCOF * stride],
+                                                               ci[X3THM1 * stride],
+                                                               ci[X1MTH2 * stride],
+                                                               ci[X7THM1 * stride],
+                                                               ci[COSIO * stride],
+                                                               ci[SINIO * stride],
+                                                               positions[out],
+                                                               velocities[out]);
+        }
+    }
+};
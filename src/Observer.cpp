@@ -17,6 +17,7 @@
 #include "Observer.hpp"
 
 #include "CoordTopocentric.hpp"
+#include "CoordinateKernel.hpp"
 namespace LSGP4
 {
     /*
@@ -30,51 +31,25 @@ namespace LSGP4
      */
         Update(eci.GetDateTime());
 
-        /*
-     * calculate differences
-     */
-        Vector range_rate = eci.Velocity() - m_eci.Velocity();
-        Vector range = eci.Position() - m_eci.Position();
-
-        range.w = range.Magnitude();
-
-        /*
-     * Calculate Local Mean Sidereal Time for observers longitude
-     */
-        double theta = eci.GetDateTime().ToLocalMeanSiderealTime(m_geo.longitude);
-
-        double sin_lat = sin(m_geo.latitude);
-        double cos_lat = cos(m_geo.latitude);
-        double sin_theta = sin(theta);
-        double cos_theta = cos(theta);
-
-        double top_s = sin_lat * cos_theta * range.x + sin_lat * sin_theta * range.y - cos_lat * range.z;
-        double top_e = -sin_theta * range.x + cos_theta * range.y;
-        double top_z = cos_lat * cos_theta * range.x + cos_lat * sin_theta * range.y + sin_lat * range.z;
-        double az = atan(-top_e / top_s);
-
-        if (top_s > 0.0)
-        {
-            az += kPI;
-        }
-
-        if (az < 0.0)
-        {
-            az += 2.0 * kPI;
-        }
+        return CoordinateKernel::GetLookAngle(m_station, eci.Position(), eci.Velocity());
+    }
 
-        double el = asin(top_z / range.w);
-        double rate = range.Dot(range_rate) / range.w;
+    void Observer::GetLookAngles(const DateTime &dt,
+                                 const double *x,
+                                 const double *y,
+                                 const double *z,
+                                 const double *vx,
+                                 const double *vy,
+                                 const double *vz,
+                                 size_t n,
+                                 double *azimuth,
+                                 double *elevation,
+                                 double *range,
+                                 double *range_rate)
+    {
+        Update(dt);
 
-        /*
-     * azimuth in radians
-     * elevation in radians
-     * range in km
-     * range rate in km/s
-     */
-        return CoordTopocentric(az,
-                                el,
-                                range.w,
-                                rate);
+        CoordinateKernel::GetLookAngles(NearSpaceKernel::BestIsa(), m_station, x, y, z, vx, vy, vz, n,
+                                        azimuth, elevation, range, range_rate);
     }
-};
\ No newline at end of file
+};
@@ -20,18 +20,23 @@
 namespace LSGP4
 {
     OrbitalElements::OrbitalElements(const Tle &tle)
+        : OrbitalElements(tle.Record())
+    {
+    }
+
+    OrbitalElements::OrbitalElements(const TleRecord &record)
     {
         /*
      * extract and format tle data
      */
-        mean_anomoly_ = tle.MeanAnomaly(false);
-        ascending_node_ = tle.RightAscendingNode(false);
-        argument_perigee_ = tle.ArgumentPerigee(false);
-        eccentricity_ = tle.Eccentricity();
-        inclination_ = tle.Inclination(false);
-        mean_motion_ = tle.MeanMotion() * kTWOPI / kMINUTES_PER_DAY;
-        bstar_ = tle.BStar();
-        epoch_ = tle.Epoch();
+        mean_anomoly_ = Util::DegreesToRadians(record.mean_anomaly);
+        ascending_node_ = Util::DegreesToRadians(record.right_ascending_node);
+        argument_perigee_ = Util::DegreesToRadians(record.argument_perigee);
+        eccentricity_ = record.eccentricity;
+        inclination_ = Util::DegreesToRadians(record.inclination);
+        mean_motion_ = record.mean_motion * kTWOPI / kMINUTES_PER_DAY;
+        bstar_ = record.bstar;
+        epoch_ = DateTime(record.epoch);
 
         /*
      * recover original mean motion (xnodp) and semimajor axis (aodp)
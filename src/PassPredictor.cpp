@@ -0,0 +1,502 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PassPredictor.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+    using namespace LSGP4;
+
+    const int kMaxIterations = 100;
+
+    /*
+     * elevation above the minimum, against seconds from the start
+     */
+    class ElevationFunction
+    {
+    public:
+        ElevationFunction(const SGP4 &sgp4,
+                          const Observer &observer,
+                          const DateTime &start,
+                          double min_elevation)
+            : sgp4_(sgp4), observer_(observer), start_(start), min_elevation_(min_elevation)
+        {
+        }
+
+        double operator()(double seconds)
+        {
+            return LookAngle(seconds).elevation - min_elevation_;
+        }
+
+        /*
+         * a decayed satellite is looked at where it decayed, so the search
+         * can refine up to the last sample before decay
+         */
+        CoordTopocentric LookAngle(double seconds)
+        {
+            SGP4::Status status;
+            return LookAngle(seconds, status);
+        }
+
+        CoordTopocentric LookAngle(double seconds, SGP4::Status &status)
+        {
+            const DateTime dt = Time(seconds);
+            Vector position;
+            Vector velocity;
+            status = sgp4_.FindPosition((dt - sgp4_.GetOrbitalElements().Epoch()).TotalMinutes(),
+                                        integ_params_, position, velocity);
+            return observer_.GetLookAngle(Eci(dt, position, velocity));
+        }
+
+        DateTime Time(double seconds) const
+        {
+            return start_.AddSeconds(seconds);
+        }
+
+    private:
+        const SGP4 &sgp4_;
+        Observer observer_;
+        DateTime start_;
+        double min_elevation_;
+        SGP4::IntegratorParams integ_params_;
+    };
+
+    /*
+     * Brent's method for a root of f in [a, b], where fa and fb differ in sign
+     */
+    double FindRoot(ElevationFunction &f,
+                    double a,
+                    double fa,
+                    double b,
+                    double fb,
+                    double tolerance)
+    {
+        double c = b;
+        double fc = fb;
+        double d = b - a;
+        double e = d;
+
+        for (int i = 0; i < kMaxIterations; i++)
+        {
+            if ((fb > 0.0) == (fc > 0.0))
+            {
+                c = a;
+                fc = fa;
+                d = b - a;
+                e = d;
+            }
+            if (fabs(fc) < fabs(fb))
+            {
+                a = b;
+                b = c;
+                c = a;
+                fa = fb;
+                fb = fc;
+                fc = fa;
+            }
+
+            const double tol = 2.0 * DBL_EPSILON * fabs(b) + 0.5 * tolerance;
+            const double xm = 0.5 * (c - b);
+            if (fabs(xm) <= tol || fb == 0.0)
+            {
+                return b;
+            }
+
+            if (fabs(e) >= tol && fabs(fa) > fabs(fb))
+            {
+                /*
+                 * inverse quadratic interpolation, or secant when a == c
+                 */
+                const double s = fb / fa;
+                double p;
+                double q;
+                if (a == c)
+                {
+                    p = 2.0 * xm * s;
+                    q = 1.0 - s;
+                }
+                else
+                {
+                    const double qa = fa / fc;
+                    const double r = fb / fc;
+                    p = s * (2.0 * xm * qa * (qa - r) - (b - a) * (r - 1.0));
+                    q = (qa - 1.0) * (r - 1.0) * (s - 1.0);
+                }
+                if (p > 0.0)
+                {
+                    q = -q;
+                }
+                p = fabs(p);
+
+                if (2.0 * p < std::min(3.0 * xm * q - fabs(tol * q), fabs(e * q)))
+                {
+                    e = d;
+                    d = p / q;
+                }
+                else
+                {
+                    d = xm;
+                    e = d;
+                }
+            }
+            else
+            {
+                d = xm;
+                e = d;
+            }
+
+            a = b;
+            fa = fb;
+            b += fabs(d) > tol ? d : (xm > 0.0 ? tol : -tol);
+            fb = f(b);
+        }
+
+        return b;
+    }
+
+    /*
+     * Brent's method for the maximum of f in [a, b], starting from x with
+     * f(x) = fx. returns the time of the maximum and sets fx to its value
+     */
+    double FindMaximum(ElevationFunction &f,
+                       double a,
+                       double b,
+                       double x,
+                       double &fx,
+                       double tolerance)
+    {
+        const double golden = 0.3819660112501051;
+
+        /*
+         * minimise g = -f
+         */
+        double gx = -fx;
+        double w = x;
+        double gw = gx;
+        double v = x;
+        double gv = gx;
+        double d = 0.0;
+        double e = 0.0;
+
+        for (int i = 0; i < kMaxIterations; i++)
+        {
+            const double xm = 0.5 * (a + b);
+            const double tol1 = tolerance + DBL_EPSILON * fabs(x);
+            const double tol2 = 2.0 * tol1;
+            if (fabs(x - xm) <= tol2 - 0.5 * (b - a))
+            {
+                break;
+            }
+
+            bool golden_step = true;
+            if (fabs(e) > tol1)
+            {
+                /*
+                 * parabola through x, v and w
+                 */
+                const double r = (x - w) * (gx - gv);
+                double q = (x - v) * (gx - gw);
+                double p = (x - v) * q - (x - w) * r;
+                q = 2.0 * (q - r);
+                if (q > 0.0)
+                {
+                    p = -p;
+                }
+                q = fabs(q);
+                const double etemp = e;
+                e = d;
+
+                if (fabs(p) < fabs(0.5 * q * etemp) && p > q * (a - x) && p < q * (b - x))
+                {
+                    d = p / q;
+                    const double u = x + d;
+                    if (u - a < tol2 || b - u < tol2)
+                    {
+                        d = xm > x ? tol1 : -tol1;
+                    }
+                    golden_step = false;
+                }
+            }
+            if (golden_step)
+            {
+                e = (x >= xm ? a - x : b - x);
+                d = golden * e;
+            }
+
+            const double u = fabs(d) >= tol1 ? x + d : x + (d > 0.0 ? tol1 : -tol1);
+            const double gu = -f(u);
+
+            if (gu <= gx)
+            {
+                if (u >= x)
+                {
+                    a = x;
+                }
+                else
+                {
+                    b = x;
+                }
+                v = w;
+                gv = gw;
+                w = x;
+                gw = gx;
+                x = u;
+                gx = gu;
+            }
+            else
+            {
+                if (u < x)
+                {
+                    a = u;
+                }
+                else
+                {
+                    b = u;
+                }
+                if (gu <= gw || w == x)
+                {
+                    v = w;
+                    gv = gw;
+                    w = u;
+                    gw = gu;
+                }
+                else if (gu <= gv || v == x || v == w)
+                {
+                    v = u;
+                    gv = gu;
+                }
+            }
+        }
+
+        fx = -gx;
+        return x;
+    }
+
+    /*
+     * the time of maximum elevation of a pass from aos to los, around the
+     * highest sample
+     */
+    double Culmination(ElevationFunction &f,
+                       const std::vector<double> &times,
+                       const std::vector<double> &elevations,
+                       double min_elevation,
+                       size_t best,
+                       double aos,
+                       double los,
+                       double tolerance)
+    {
+        const double a = best > 0 ? std::max(aos, times[best - 1]) : aos;
+        const double b = best + 1 < times.size() ? std::min(los, times[best + 1]) : los;
+        double f_max = elevations[best] - min_elevation;
+        return FindMaximum(f, a, b, times[best], f_max, tolerance);
+    }
+
+    PassDetails MakePass(ElevationFunction &f,
+                         double aos,
+                         double culmination,
+                         double los,
+                         bool aos_at_start,
+                         bool los_at_end)
+    {
+        PassDetails pass;
+        pass.aos = f.Time(aos);
+        pass.culmination = f.Time(culmination);
+        pass.los = f.Time(los);
+        pass.aos_look_angle = f.LookAngle(aos);
+        pass.culmination_look_angle = f.LookAngle(culmination);
+        pass.los_look_angle = f.LookAngle(los);
+        pass.aos_at_start = aos_at_start;
+        pass.los_at_end = los_at_end;
+        return pass;
+    }
+}
+
+namespace LSGP4
+{
+    PassPredictor::PassPredictor(const SGP4 &sgp4,
+                                 const Observer &observer,
+                                 double min_elevation)
+        : sgp4_(sgp4),
+          observer_(observer),
+          min_elevation_(min_elevation),
+          time_step_(DefaultTimeStep(sgp4)),
+          tolerance_(0.01)
+    {
+    }
+
+    void PassPredictor::SetTimeStep(const TimeSpan &step)
+    {
+        time_step_ = step.TotalSeconds();
+    }
+
+    void PassPredictor::SetTolerance(const TimeSpan &tolerance)
+    {
+        tolerance_ = tolerance.TotalSeconds();
+    }
+
+    std::vector<PassDetails> PassPredictor::FindPasses(const DateTime &start,
+                                                       const DateTime &end) const
+    {
+        std::vector<PassDetails> passes;
+        const double span = (end - start).TotalSeconds();
+        if (!(span > 0.0) || !(time_step_ > 0.0))
+        {
+            return passes;
+        }
+
+        ElevationFunction f(sgp4_, observer_, start, min_elevation_);
+
+        /*
+         * the search ends at the last sample the satellite propagates to
+         */
+        std::vector<double> times = SampleTimes(time_step_, span);
+        std::vector<double> elevations(times.size());
+        for (size_t i = 0; i < times.size(); i++)
+        {
+            SGP4::Status status;
+            elevations[i] = f.LookAngle(times[i], status).elevation;
+            if (status != SGP4::OK)
+            {
+                times.resize(i);
+                elevations.resize(i);
+                break;
+            }
+        }
+
+        FindPasses(sgp4_, observer_, min_elevation_, tolerance_, start, times, elevations, passes);
+        return passes;
+    }
+
+    double PassPredictor::DefaultTimeStep(const SGP4 &sgp4)
+    {
+        /*
+         * a twentieth of an orbit brackets one elevation maximum per orbit
+         */
+        const double period = sgp4.GetOrbitalElements().Period() * 60.0;
+        return std::min(period / 20.0, 600.0);
+    }
+
+    std::vector<double> PassPredictor::SampleTimes(double step, double span)
+    {
+        std::vector<double> times;
+        for (double t = 0.0; ; t = std::min(t + step, span))
+        {
+            times.push_back(t);
+            if (t >= span)
+            {
+                break;
+            }
+        }
+        return times;
+    }
+
+    void PassPredictor::FindPasses(const SGP4 &sgp4,
+                                   const Observer &observer,
+                                   double min_elevation,
+                                   double tolerance,
+                                   const DateTime &start,
+                                   const std::vector<double> &times,
+                                   const std::vector<double> &elevations,
+                                   std::vector<PassDetails> &passes)
+    {
+        const size_t n = times.size();
+        if (n == 0)
+        {
+            return;
+        }
+
+        ElevationFunction f(sgp4, observer, start, min_elevation);
+
+        bool in_pass = elevations[0] > min_elevation;
+        bool aos_at_start = in_pass;
+        double aos = 0.0;
+        /*
+         * the highest sample of the current pass
+         */
+        size_t best = 0;
+
+        for (size_t i = 1; i < n; i++)
+        {
+            const double t0 = times[i - 1];
+            const double f0 = elevations[i - 1] - min_elevation;
+            const double t1 = times[i];
+            const double f1 = elevations[i] - min_elevation;
+
+            if (!in_pass)
+            {
+                if (f1 > 0.0)
+                {
+                    aos = FindRoot(f, t0, f0, t1, f1, tolerance);
+                    aos_at_start = false;
+                    in_pass = true;
+                    best = i;
+                }
+                else if (i >= 2 && f0 > elevations[i - 2] - min_elevation && f0 >= f1)
+                {
+                    const double t_prev = times[i - 2];
+                    const double f_prev = elevations[i - 2] - min_elevation;
+
+                    /*
+                     * the satellite may rise and set between samples. where
+                     * the elevation is concave, as around a maximum, each
+                     * chord extended past the middle sample bounds it
+                     */
+                    const double climb = (f0 - f_prev) / (t0 - t_prev) * (t1 - t0);
+                    const double drop = (f0 - f1) / (t1 - t0) * (t0 - t_prev);
+                    if (f0 + std::max(climb, drop) <= 0.0)
+                    {
+                        continue;
+                    }
+
+                    double f_max = f0;
+                    const double t_max = FindMaximum(f, t_prev, t1, t0, f_max, tolerance);
+                    if (f_max > 0.0)
+                    {
+                        const double rise = FindRoot(f, t_prev, f_prev, t_max, f_max, tolerance);
+                        const double set = FindRoot(f, t_max, f_max, t1, f1, tolerance);
+                        passes.push_back(MakePass(f, rise, t_max, set, false, false));
+                    }
+                }
+            }
+            else
+            {
+                if (elevations[i] > elevations[best])
+                {
+                    best = i;
+                }
+
+                if (f1 <= 0.0)
+                {
+                    const double los = FindRoot(f, t0, f0, t1, f1, tolerance);
+                    const double culmination = Culmination(f, times, elevations, min_elevation, best, aos, los, tolerance);
+                    passes.push_back(MakePass(f, aos, culmination, los, aos_at_start, false));
+                    in_pass = false;
+                }
+            }
+        }
+
+        if (in_pass)
+        {
+            const double los = times[n - 1];
+            const double culmination = Culmination(f, times, elevations, min_elevation, best, aos, los, tolerance);
+            passes.push_back(MakePass(f, aos, culmination, los, aos_at_start, true));
+        }
+    }
+};
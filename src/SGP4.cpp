@@ -23,17 +23,82 @@
 
 #include <cmath>
 #include <iomanip>
+#include <atomic>
 #include <cstring>
+#include <mutex>
+#include <vector>
 
 namespace LSGP4
 {
+    namespace
+    {
+        /*
+         * resonance integrator step, and step squared / 2
+         */
+        const double kIntegratorStep = 720.0;
+        const double kIntegratorStep2 = 259200.0;
+
+        /*
+         * checkpoints kept in each direction from epoch, about 27 years
+         */
+        const size_t kMaxIntegratorCheckpoints = 20000;
+
+        /*
+         * checkpoints are stored in fixed chunks, so entries never move once
+         * published
+         */
+        const size_t kCheckpointChunk = 256;
+        const size_t kCheckpointChunks = kMaxIntegratorCheckpoints / kCheckpointChunk + 1;
+    }
+
+    /*
+     * integrator states at whole steps from epoch, index 0 being epoch.
+     * entries below size are never written again, so readers load size and
+     * read them without a lock; the mutex only serialises extending a table.
+     */
+    struct SGP4::IntegratorCheckpoints
+    {
+        struct Table
+        {
+            Table()
+                : size(0)
+            {
+                for (size_t i = 0; i < kCheckpointChunks; i++)
+                {
+                    chunks[i] = NULL;
+                }
+            }
+
+            ~Table()
+            {
+                for (size_t i = 0; i < kCheckpointChunks; i++)
+                {
+                    delete[] chunks[i];
+                }
+            }
+
+            const IntegratorParams &operator[](size_t i) const
+            {
+                return chunks[i / kCheckpointChunk][i % kCheckpointChunk];
+            }
+
+            std::atomic<size_t> size;
+            IntegratorParams *chunks[kCheckpointChunks];
+        };
+
+        std::mutex mutex;
+        Table forward;
+        Table backward;
+    };
+
     void SGP4::SetTle(const Tle &tle)
     {
         /*
      * extract and format tle data
      */
+        tle_ = std::make_shared<const Tle>(tle);
         elements_ = OrbitalElements(tle);
-        tle_ = tle;
+        record_ = tle.Record();
 
         Initialise();
     }
@@ -152,6 +217,8 @@ namespace LSGP4
                                 common_consts_.xmdot,
                                 common_consts_.omgdot,
                                 common_consts_.xnodot);
+
+            SetIntegratorCheckpoints(use_integrator_checkpoints_);
         }
         else
         {
@@ -190,24 +257,209 @@ namespace LSGP4
         }
     }
 
+    void SGP4::SetIntegratorCheckpoints(bool enable)
+    {
+        use_integrator_checkpoints_ = enable;
+
+        if (enable && use_deep_space_ && deepspace_consts_.shape != DeepSpaceConstants::NONE)
+        {
+            if (!integrator_checkpoints_)
+            {
+                integrator_checkpoints_ = std::make_shared<IntegratorCheckpoints>();
+            }
+        }
+        else
+        {
+            integrator_checkpoints_.reset();
+        }
+    }
+
     Eci SGP4::FindPosition(const DateTime &dt) const
     {
         return FindPosition((dt - elements_.Epoch()).TotalMinutes());
     }
 
     Eci SGP4::FindPosition(double tsince) const
+    {
+        /*
+         * integrate from epoch, or the nearest checkpoint
+         */
+        IntegratorParams integ_params;
+        return FindPosition(tsince, integ_params);
+    }
+
+    Eci SGP4::FindPosition(const DateTime &dt, IntegratorParams &integ_params) const
+    {
+        return FindPosition((dt - elements_.Epoch()).TotalMinutes(), integ_params);
+    }
+
+    Eci SGP4::FindPosition(double tsince, IntegratorParams &integ_params) const
+    {
+        Vector position;
+        Vector velocity;
+
+        const SGP4::Status status = FindPosition(tsince, integ_params, position, velocity);
+        if (status != SGP4::OK)
+        {
+            ThrowStatus(status, tsince, position, velocity);
+        }
+
+        return Eci(elements_.Epoch().AddMinutes(tsince), position, velocity);
+    }
+
+    SGP4::Status SGP4::FindPosition(double tsince,
+                                    IntegratorParams &integ_params,
+                                    Vector &position,
+                                    Vector &velocity) const
     {
         if (use_deep_space_)
         {
-            return FindPositionSDP4(tsince);
+            return FindPositionSDP4(tsince, integ_params, position, velocity);
+        }
+        else if (use_simple_model_)
+        {
+            return FindPositionSGP4<true>(tsince, position, velocity);
         }
         else
         {
-            return FindPositionSGP4(tsince);
+            return FindPositionSGP4<false>(tsince, position, velocity);
+        }
+    }
+
+    template <bool DeepSpace, bool SimpleModel>
+    SGP4::Status SGP4::FindPosition(double tsince,
+                                    IntegratorParams &integ_params,
+                                    Vector &position,
+                                    Vector &velocity) const
+    {
+        if (DeepSpace)
+        {
+            return FindPositionSDP4(tsince, integ_params, position, velocity);
+        }
+        else
+        {
+            return FindPositionSGP4<SimpleModel>(tsince, position, velocity);
+        }
+    }
+
+    template SGP4::Status SGP4::FindPosition<false, false>(double, IntegratorParams &, Vector &, Vector &) const;
+    template SGP4::Status SGP4::FindPosition<false, true>(double, IntegratorParams &, Vector &, Vector &) const;
+    template SGP4::Status SGP4::FindPosition<true, false>(double, IntegratorParams &, Vector &, Vector &) const;
+
+    namespace
+    {
+        /*
+         * samples [0, n) with the model fixed. samples are usually ordered,
+         * so each one continues the integration from the last. with no
+         * status array, stops at the first failure and returns its index and
+         * status
+         */
+        template <bool DeepSpace, bool SimpleModel>
+        size_t PropagateModelSamples(const SGP4 &sgp4,
+                                     const double *tsince,
+                                     size_t n,
+                                     Vector *positions,
+                                     Vector *velocities,
+                                     unsigned char *status,
+                                     SGP4::Status &failure)
+        {
+            SGP4::IntegratorParams integ_params;
+            for (size_t i = 0; i < n; i++)
+            {
+                const SGP4::Status result =
+                    sgp4.FindPosition<DeepSpace, SimpleModel>(tsince[i], integ_params, positions[i], velocities[i]);
+
+                if (status != NULL)
+                {
+                    status[i] = static_cast<unsigned char>(result);
+                }
+                else if (result != SGP4::OK)
+                {
+                    failure = result;
+                    return i;
+                }
+            }
+            return n;
+        }
+
+        /*
+         * decide on the model once for the whole batch
+         */
+        size_t PropagateSamples(const SGP4 &sgp4,
+                                const double *tsince,
+                                size_t n,
+                                Vector *positions,
+                                Vector *velocities,
+                                unsigned char *status,
+                                SGP4::Status &failure)
+        {
+            if (sgp4.UseDeepSpace())
+            {
+                return PropagateModelSamples<true, false>(sgp4, tsince, n, positions, velocities, status, failure);
+            }
+            else if (sgp4.UseSimpleModel())
+            {
+                return PropagateModelSamples<false, true>(sgp4, tsince, n, positions, velocities, status, failure);
+            }
+            else
+            {
+                return PropagateModelSamples<false, false>(sgp4, tsince, n, positions, velocities, status, failure);
+            }
+        }
+    }
+
+    void SGP4::FindPositions(const double *tsince,
+                             size_t n,
+                             Vector *positions,
+                             Vector *velocities) const
+    {
+        SGP4::Status failure = SGP4::OK;
+        const size_t i = PropagateSamples(*this, tsince, n, positions, velocities, NULL, failure);
+        if (i < n)
+        {
+            ThrowStatus(failure, tsince[i], positions[i], velocities[i]);
         }
     }
 
-    Eci SGP4::FindPositionSDP4(double tsince) const
+    void SGP4::FindPositions(const double *tsince,
+                             size_t n,
+                             Vector *positions,
+                             Vector *velocities,
+                             unsigned char *status) const
+    {
+        SGP4::Status failure = SGP4::OK;
+        PropagateSamples(*this, tsince, n, positions, velocities, status, failure);
+    }
+
+    void SGP4::ThrowStatus(Status status,
+                           const double tsince,
+                           const Vector &position,
+                           const Vector &velocity) const
+    {
+        switch (status)
+        {
+        case SGP4::ECCENTRICITY:
+            throw SatelliteException("Error: (e <= -0.001)");
+        case SGP4::ELSQ:
+            throw SatelliteException("Error: (elsq >= 1.0)");
+        case SGP4::SEMI_LATUS_RECTUM:
+            throw SatelliteException("Error: (pl < 0.0)");
+        case SGP4::MEAN_MOTION:
+            throw SatelliteException("Error: (xn <= 0.0)");
+        case SGP4::DECAYED:
+            throw DecayedException(elements_.Epoch().AddMinutes(tsince), position, velocity);
+        case SGP4::OK:
+            break;
+        default:
+            throw SatelliteException("Error: unknown propagation status");
+        }
+    }
+
+    SGP4::Status SGP4::FindPositionSDP4(const double tsince,
+                                        IntegratorParams &integ_params,
+                                        Vector &position,
+                                        Vector &velocity,
+                                        KeplerSeed *seed) const
     {
         /*
      * the final values
@@ -236,11 +488,16 @@ namespace LSGP4
         double em = elements_.Eccentricity();
         xinc = elements_.Inclination();
 
+        if (integrator_checkpoints_)
+        {
+            SeekIntegratorCheckpoint(tsince, integ_params);
+        }
+
         DeepSpaceSecular(tsince,
                          elements_,
                          common_consts_,
                          deepspace_consts_,
-                         integrator_params_,
+                         integ_params,
                          xmdf,
                          omgadf,
                          xnode,
@@ -250,7 +507,9 @@ namespace LSGP4
 
         if (xn <= 0.0)
         {
-            throw SatelliteException("Error: (xn <= 0.0)");
+            position = Vector();
+            velocity = Vector();
+            return SGP4::MEAN_MOTION;
         }
 
         a = pow(kXKE / xn, kTWOTHIRD) * tempa * tempa;
@@ -284,7 +543,9 @@ namespace LSGP4
      */
         if (e <= -0.001)
         {
-            throw SatelliteException("Error: (e <= -0.001)");
+            position = Vector();
+            velocity = Vector();
+            return SGP4::ECCENTRICITY;
         }
         else if (e < 1.0e-6)
         {
@@ -317,8 +578,7 @@ namespace LSGP4
         /*
      * using calculated values, find position and velocity
      */
-        return CalculateFinalPositionVelocity(elements_.Epoch().AddMinutes(tsince),
-                                              e,
+        return CalculateFinalPositionVelocity(e,
                                               a,
                                               omega,
                                               xl,
@@ -330,7 +590,10 @@ namespace LSGP4
                                               perturbed_x1mth2,
                                               perturbed_x7thm1,
                                               perturbed_cosio,
-                                              perturbed_sinio);
+                                              perturbed_sinio,
+                                              position,
+                                              velocity,
+                                              seed);
     }
 
     void SGP4::RecomputeConstants(const double xinc,
@@ -363,7 +626,11 @@ namespace LSGP4
         aycof = 0.25 * kA3OVK2 * sinio;
     }
 
-    Eci SGP4::FindPositionSGP4(double tsince) const
+    template <bool SimpleModel>
+    SGP4::Status SGP4::FindPositionSGP4(const double tsince,
+                                        Vector &position,
+                                        Vector &velocity,
+                                        KeplerSeed *seed) const
     {
         /*
      * the final values
@@ -391,7 +658,7 @@ namespace LSGP4
         double tempe = elements_.BStar() * common_consts_.c4 * tsince;
         double templ = common_consts_.t2cof * tsq;
 
-        if (!use_simple_model_)
+        if (!SimpleModel)
         {
             const double delomg = nearspace_consts_.omgcof * tsince;
             const double delm = nearspace_consts_.xmcof * (pow(1.0 + common_consts_.eta * cos(xmdf), 3.0) - nearspace_consts_.delmo);
@@ -417,7 +684,9 @@ namespace LSGP4
      */
         if (e <= -0.001)
         {
-            throw SatelliteException("Error: (e <= -0.001)");
+            position = Vector();
+            velocity = Vector();
+            return SGP4::ECCENTRICITY;
         }
         else if (e < 1.0e-6)
         {
@@ -432,8 +701,7 @@ namespace LSGP4
      * using calculated values, find position and velocity
      * we can pass in constants from Initialise() as these dont change
      */
-        return CalculateFinalPositionVelocity(elements_.Epoch().AddMinutes(tsince),
-                                              e,
+        return CalculateFinalPositionVelocity(e,
                                               a,
                                               omega,
                                               xl,
@@ -445,11 +713,16 @@ namespace LSGP4
                                               common_consts_.x1mth2,
                                               common_consts_.x7thm1,
                                               common_consts_.cosio,
-                                              common_consts_.sinio);
+                                              common_consts_.sinio,
+                                              position,
+                                              velocity,
+                                              seed);
     }
 
-    Eci SGP4::CalculateFinalPositionVelocity(
-        const DateTime &dt,
+    template SGP4::Status SGP4::FindPositionSGP4<false>(const double, Vector &, Vector &, KeplerSeed *) const;
+    template SGP4::Status SGP4::FindPositionSGP4<true>(const double, Vector &, Vector &, KeplerSeed *) const;
+
+    SGP4::Status SGP4::CalculateFinalPositionVelocity(
         const double e,
         const double a,
         const double omega,
@@ -462,7 +735,10 @@ namespace LSGP4
         const double x1mth2,
         const double x7thm1,
         const double cosio,
-        const double sinio)
+        const double sinio,
+        Vector &position,
+        Vector &velocity,
+        KeplerSeed *seed)
     {
         const double beta2 = 1.0 - e * e;
         const double xn = kXKE / pow(a, 1.5);
@@ -479,7 +755,9 @@ namespace LSGP4
 
         if (elsq >= 1.0)
         {
-            throw SatelliteException("Error: (elsq >= 1.0)");
+            position = Vector();
+            velocity = Vector();
+            return SGP4::ELSQ;
         }
 
         /*
@@ -493,6 +771,21 @@ namespace LSGP4
         const double capu = fmod(xlt - xnode, kTWOPI);
         double epw = capu;
 
+        /*
+     * continue from the last solution, advanced by the change in the mean
+     * anomaly since over the rate of change of Kepler's equation there
+     */
+        if (seed != NULL && seed->valid)
+        {
+            /*
+             * capu is reduced with fmod, so it jumps by a turn once an orbit.
+             * the seed is moved by the same whole turns, onto the same turn
+             * as capu
+             */
+            const double delta = Util::WrapNegPosPI(capu - seed->capu);
+            epw = seed->epw + (capu - delta - seed->capu) + delta / seed->fdot;
+        }
+
         double sinepw = 0.0;
         double cosepw = 0.0;
         double ecose = 0.0;
@@ -552,6 +845,15 @@ namespace LSGP4
                 epw += delta_epw;
             }
         }
+
+        if (seed != NULL)
+        {
+            seed->valid = true;
+            seed->capu = capu;
+            seed->epw = epw;
+            seed->fdot = 1.0 - ecose;
+        }
+
         /*
      * short period preliminary quantities
      */
@@ -560,7 +862,9 @@ namespace LSGP4
 
         if (pl < 0.0)
         {
-            throw SatelliteException("Error: (pl < 0.0)");
+            position = Vector();
+            velocity = Vector();
+            return SGP4::SEMI_LATUS_RECTUM;
         }
 
         const double r = a * (1.0 - ecose);
@@ -613,21 +917,18 @@ namespace LSGP4
         const double x = rk * ux * kXKMPER;
         const double y = rk * uy * kXKMPER;
         const double z = rk * uz * kXKMPER;
-        Vector position(x, y, z);
+        position = Vector(x, y, z);
         const double xdot = (rdotk * ux + rfdotk * vx) * kXKMPER / 60.0;
         const double ydot = (rdotk * uy + rfdotk * vy) * kXKMPER / 60.0;
         const double zdot = (rdotk * uz + rfdotk * vz) * kXKMPER / 60.0;
-        Vector velocity(xdot, ydot, zdot);
+        velocity = Vector(xdot, ydot, zdot);
 
         if (rk < 1.0)
         {
-            throw DecayedException(
-                dt,
-                position,
-                velocity);
+            return SGP4::DECAYED;
         }
 
-        return Eci(dt, position, velocity);
+        return SGP4::OK;
     }
 
     static inline double EvaluateCubicPolynomial(
@@ -1000,12 +1301,10 @@ namespace LSGP4
         if (deepspace_consts_.shape != DeepSpaceConstants::NONE)
         {
             /*
-         * initialise integrator
+         * initialise integrator, which starts from xlamo and the
+         * recovered mean motion at epoch
          */
             deepspace_consts_.xfact = bfact - elements_.RecoveredMeanMotion();
-            integrator_params_.atime = 0.0;
-            integrator_params_.xni = elements_.RecoveredMeanMotion();
-            integrator_params_.xli = deepspace_consts_.xlamo;
         }
     }
 
@@ -1122,18 +1421,14 @@ namespace LSGP4
         }
     }
 
-    void SGP4::DeepSpaceSecular(
-        const double tsince,
+    void SGP4::DeepSpaceIntegratorRates(
         const OrbitalElements &elements,
         const CommonConstants &c_constants,
         const DeepSpaceConstants &ds_constants,
-        IntegratorParams &integ_params,
-        double &xll,
-        double &omgasm,
-        double &xnodes,
-        double &em,
-        double &xinc,
-        double &xn)
+        const IntegratorParams &integ_params,
+        double &xndot,
+        double &xnddt,
+        double &xldot)
     {
         static const double G22 = 5.7686396;
         static const double G32 = 0.95240898;
@@ -1144,9 +1439,124 @@ namespace LSGP4
         static const double FASX4 = 2.8843198;
         static const double FASX6 = 0.37448087;
 
-        static const double STEP = 720.0;
-        static const double STEP2 = 259200.0;
+        if (ds_constants.shape == DeepSpaceConstants::SYNCHRONOUS)
+        {
+            xndot = ds_constants.del1 * sin(integ_params.xli - FASX2) + ds_constants.del2 * sin(2.0 * (integ_params.xli - FASX4)) + ds_constants.del3 * sin(3.0 * (integ_params.xli - FASX6));
+            xnddt = ds_constants.del1 * cos(integ_params.xli - FASX2) + 2.0 * ds_constants.del2 * cos(2.0 * (integ_params.xli - FASX4)) + 3.0 * ds_constants.del3 * cos(3.0 * (integ_params.xli - FASX6));
+        }
+        else
+        {
+            // TODO: check
+            const double xomi = elements.ArgumentPerigee() + c_constants.omgdot * integ_params.atime;
+            const double x2omi = xomi + xomi;
+            const double x2li = integ_params.xli + integ_params.xli;
+            xndot = ds_constants.d2201 * sin(x2omi + integ_params.xli - G22) + ds_constants.d2211 * sin(integ_params.xli - G22) + ds_constants.d3210 * sin(xomi + integ_params.xli - G32) + ds_constants.d3222 * sin(-xomi + integ_params.xli - G32) + ds_constants.d4410 * sin(x2omi + x2li - G44) + ds_constants.d4422 * sin(x2li - G44) + ds_constants.d5220 * sin(xomi + integ_params.xli - G52) + ds_constants.d5232 * sin(-xomi + integ_params.xli - G52) + ds_constants.d5421 * sin(xomi + x2li - G54) + ds_constants.d5433 * sin(-xomi + x2li - G54);
+            xnddt = ds_constants.d2201 * cos(x2omi + integ_params.xli - G22) + ds_constants.d2211 * cos(integ_params.xli - G22) + ds_constants.d3210 * cos(xomi + integ_params.xli - G32) + ds_constants.d3222 * cos(-xomi + integ_params.xli - G32) + ds_constants.d5220 * cos(xomi + integ_params.xli - G52) + ds_constants.d5232 * cos(-xomi + integ_params.xli - G52) + 2.0 * (ds_constants.d4410 * cos(x2omi + x2li - G44) + ds_constants.d4422 * cos(x2li - G44) + ds_constants.d5421 * cos(xomi + x2li - G54) + ds_constants.d5433 * cos(-xomi + x2li - G54));
+        }
+        xldot = integ_params.xni + ds_constants.xfact;
+        xnddt *= xldot;
+    }
+
+    void SGP4::SeekIntegratorCheckpoint(const double tsince,
+                                        IntegratorParams &integ_params) const
+    {
+        /*
+         * the last whole step at or before tsince, which DeepSpaceSecular
+         * continues from without restarting
+         */
+        size_t steps = static_cast<size_t>(fabs(tsince) / kIntegratorStep);
+        if (steps > 0 && static_cast<double>(steps) * kIntegratorStep > fabs(tsince))
+        {
+            steps--;
+        }
+        if (steps > kMaxIntegratorCheckpoints)
+        {
+            steps = kMaxIntegratorCheckpoints;
+        }
 
+        /*
+         * keep the caller's state if DeepSpaceSecular can continue from it
+         * and it is no further from tsince than the checkpoint
+         */
+        if (fabs(tsince) >= kIntegratorStep &&
+            tsince * integ_params.atime > 0.0 &&
+            fabs(tsince) >= fabs(integ_params.atime) &&
+            fabs(integ_params.atime) >= static_cast<double>(steps) * kIntegratorStep)
+        {
+            return;
+        }
+        if (steps == 0)
+        {
+            return;
+        }
+
+        IntegratorCheckpoints::Table &table = (tsince >= 0.0 ? integrator_checkpoints_->forward
+                                                             : integrator_checkpoints_->backward);
+
+        if (steps < table.size.load(std::memory_order_acquire))
+        {
+            integ_params = table[steps];
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(integrator_checkpoints_->mutex);
+
+        size_t size = table.size.load(std::memory_order_relaxed);
+        if (size == 0)
+        {
+            table.chunks[0] = new IntegratorParams[kCheckpointChunk];
+            table.chunks[0][0].xni = elements_.RecoveredMeanMotion();
+            table.chunks[0][0].xli = deepspace_consts_.xlamo;
+            size = 1;
+        }
+
+        /*
+         * extend the table with the same steps DeepSpaceSecular takes, then
+         * publish the new entries
+         */
+        const double delt = (tsince >= 0.0 ? kIntegratorStep : -kIntegratorStep);
+        while (size <= steps)
+        {
+            IntegratorParams next = table[size - 1];
+            double xndot;
+            double xnddt;
+            double xldot;
+            DeepSpaceIntegratorRates(elements_,
+                                     common_consts_,
+                                     deepspace_consts_,
+                                     next,
+                                     xndot,
+                                     xnddt,
+                                     xldot);
+            next.xli = next.xli + xldot * delt + xndot * kIntegratorStep2;
+            next.xni = next.xni + xndot * delt + xnddt * kIntegratorStep2;
+            next.atime += delt;
+
+            if (size % kCheckpointChunk == 0)
+            {
+                table.chunks[size / kCheckpointChunk] = new IntegratorParams[kCheckpointChunk];
+            }
+            table.chunks[size / kCheckpointChunk][size % kCheckpointChunk] = next;
+            size++;
+        }
+        table.size.store(size, std::memory_order_release);
+
+        integ_params = table[steps];
+    }
+
+    void SGP4::DeepSpaceSecular(
+        const double tsince,
+        const OrbitalElements &elements,
+        const CommonConstants &c_constants,
+        const DeepSpaceConstants &ds_constants,
+        IntegratorParams &integ_params,
+        double &xll,
+        double &omgasm,
+        double &xnodes,
+        double &em,
+        double &xinc,
+        double &xn)
+    {
         xll += ds_constants.ssl * tsince;
         omgasm += ds_constants.ssg * tsince;
         xnodes += ds_constants.ssh * tsince;
@@ -1165,7 +1575,7 @@ namespace LSGP4
          * 3rd condition (if tsince is closer to zero than 
          *     atime, only integrate away from zero)
          */
-            if (fabs(tsince) < STEP ||
+            if (fabs(tsince) < kIntegratorStep ||
                 tsince * integ_params.atime <= 0.0 ||
                 fabs(tsince) < fabs(integ_params.atime))
             {
@@ -1182,31 +1592,22 @@ namespace LSGP4
             {
                 // always calculate dot terms ready for integration beginning
                 // from the start of the range which is 'atime'
-                if (ds_constants.shape == DeepSpaceConstants::SYNCHRONOUS)
-                {
-                    xndot = ds_constants.del1 * sin(integ_params.xli - FASX2) + ds_constants.del2 * sin(2.0 * (integ_params.xli - FASX4)) + ds_constants.del3 * sin(3.0 * (integ_params.xli - FASX6));
-                    xnddt = ds_constants.del1 * cos(integ_params.xli - FASX2) + 2.0 * ds_constants.del2 * cos(2.0 * (integ_params.xli - FASX4)) + 3.0 * ds_constants.del3 * cos(3.0 * (integ_params.xli - FASX6));
-                }
-                else
-                {
-                    // TODO: check
-                    const double xomi = elements.ArgumentPerigee() + c_constants.omgdot * integ_params.atime;
-                    const double x2omi = xomi + xomi;
-                    const double x2li = integ_params.xli + integ_params.xli;
-                    xndot = ds_constants.d2201 * sin(x2omi + integ_params.xli - G22) + ds_constants.d2211 * sin(integ_params.xli - G22) + ds_constants.d3210 * sin(xomi + integ_params.xli - G32) + ds_constants.d3222 * sin(-xomi + integ_params.xli - G32) + ds_constants.d4410 * sin(x2omi + x2li - G44) + ds_constants.d4422 * sin(x2li - G44) + ds_constants.d5220 * sin(xomi + integ_params.xli - G52) + ds_constants.d5232 * sin(-xomi + integ_params.xli - G52) + ds_constants.d5421 * sin(xomi + x2li - G54) + ds_constants.d5433 * sin(-xomi + x2li - G54);
-                    xnddt = ds_constants.d2201 * cos(x2omi + integ_params.xli - G22) + ds_constants.d2211 * cos(integ_params.xli - G22) + ds_constants.d3210 * cos(xomi + integ_params.xli - G32) + ds_constants.d3222 * cos(-xomi + integ_params.xli - G32) + ds_constants.d5220 * cos(xomi + integ_params.xli - G52) + ds_constants.d5232 * cos(-xomi + integ_params.xli - G52) + 2.0 * (ds_constants.d4410 * cos(x2omi + x2li - G44) + ds_constants.d4422 * cos(x2li - G44) + ds_constants.d5421 * cos(xomi + x2li - G54) + ds_constants.d5433 * cos(-xomi + x2li - G54));
-                }
-                xldot = integ_params.xni + ds_constants.xfact;
-                xnddt *= xldot;
+                DeepSpaceIntegratorRates(elements,
+                                         c_constants,
+                                         ds_constants,
+                                         integ_params,
+                                         xndot,
+                                         xnddt,
+                                         xldot);
 
                 double ft = tsince - integ_params.atime;
-                if (fabs(ft) >= STEP)
+                if (fabs(ft) >= kIntegratorStep)
                 {
-                    const double delt = (ft >= 0.0 ? STEP : -STEP);
+                    const double delt = (ft >= 0.0 ? kIntegratorStep : -kIntegratorStep);
                     // integrate by a full step ('delt'), updating the cached
                     // values for the new 'atime'
-                    integ_params.xli = integ_params.xli + xldot * delt + xndot * STEP2;
-                    integ_params.xni = integ_params.xni + xndot * delt + xnddt * STEP2;
+                    integ_params.xli = integ_params.xli + xldot * delt + xndot * kIntegratorStep2;
+                    integ_params.xni = integ_params.xni + xndot * delt + xnddt * kIntegratorStep2;
                     integ_params.atime += delt;
                 }
                 else
@@ -1238,6 +1639,6 @@ namespace LSGP4
         std::memset(&common_consts_, 0, sizeof(common_consts_));
         std::memset(&nearspace_consts_, 0, sizeof(nearspace_consts_));
         std::memset(&deepspace_consts_, 0, sizeof(deepspace_consts_));
-        std::memset(&integrator_params_, 0, sizeof(integrator_params_));
+        integrator_checkpoints_.reset();
     }
 };
\ No newline at end of file
@@ -0,0 +1,419 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SatelliteCatalogPropagator.hpp"
+
+#include <algorithm>
+
+
+namespace
+{
+    /*
+     * task sizes for the thread pool. a deep-space object costs as much as
+     * several near-space ones, so its tasks hold one object only
+     */
+    const size_t kNearSpaceTaskObjects = 256;
+    const size_t kNearSpaceTaskTimes = 16;
+    const size_t kDeepSpaceTaskTimes = 32;
+
+    /*
+     * objects [first, last) of the near-space or deep-space set at
+     * times [time_first, time_last)
+     */
+    struct GridTask
+    {
+        bool deep;
+        size_t first;
+        size_t last;
+        size_t time_first;
+        size_t time_last;
+    };
+}
+
+namespace LSGP4
+{
+    SatelliteCatalogPropagator::SatelliteCatalogPropagator(const std::vector<Tle> &tles)
+        : size_(tles.size()),
+          isa_(NearSpaceKernel::BestIsa()),
+          single_precision_(false)
+    {
+        std::vector<SGP4> near;
+
+        for (size_t i = 0; i < tles.size(); i++)
+        {
+            try
+            {
+                Add(i, SGP4(tles[i]), near);
+            }
+            catch (SatelliteException &)
+            {
+                invalid_index_.push_back(i);
+            }
+        }
+
+        PackNearSpace(near);
+    }
+
+    SatelliteCatalogPropagator::SatelliteCatalogPropagator(const std::vector<TleRecord> &records)
+        : size_(records.size()),
+          isa_(NearSpaceKernel::BestIsa()),
+          single_precision_(false)
+    {
+        std::vector<SGP4> near;
+
+        for (size_t i = 0; i < records.size(); i++)
+        {
+            try
+            {
+                Add(i, SGP4(records[i]), near);
+            }
+            catch (SatelliteException &)
+            {
+                invalid_index_.push_back(i);
+            }
+        }
+
+        PackNearSpace(near);
+    }
+
+    SatelliteCatalogPropagator::SatelliteCatalogPropagator(const std::vector<SGP4> &satellites)
+        : size_(satellites.size()),
+          isa_(NearSpaceKernel::BestIsa()),
+          single_precision_(false)
+    {
+        std::vector<SGP4> near;
+
+        for (size_t i = 0; i < satellites.size(); i++)
+        {
+            Add(i, satellites[i], near);
+        }
+
+        PackNearSpace(near);
+    }
+
+    void SatelliteCatalogPropagator::Add(size_t index, const SGP4 &sgp4, std::vector<SGP4> &near)
+    {
+        if (sgp4.use_deep_space_)
+        {
+            deep_index_.push_back(index);
+            deep_.push_back(sgp4);
+        }
+        else
+        {
+            near_index_.push_back(index);
+            near_epoch_.push_back(sgp4.elements_.Epoch().Ticks());
+            near.push_back(sgp4);
+        }
+    }
+
+    void SatelliteCatalogPropagator::PackNearSpace(const std::vector<SGP4> &near)
+    {
+        near_consts_.resize(NearSpaceKernel::FIELD_COUNT * near.size());
+        for (size_t i = 0; i < near.size(); i++)
+        {
+            NearSpaceKernel::Pack(near[i], near_consts_.data(), near.size(), i);
+        }
+    }
+
+    void SatelliteCatalogPropagator::SetKernelIsa(NearSpaceKernel::Isa isa)
+    {
+        isa_ = NearSpaceKernel::IsSupported(isa) ? isa : NearSpaceKernel::BestIsa();
+    }
+
+    void SatelliteCatalogPropagator::SetSinglePrecision(bool enable)
+    {
+        single_precision_ = enable;
+    }
+
+    void SatelliteCatalogPropagator::FindPositions(const DateTime &dt,
+                                                   Vector *positions,
+                                                   Vector *velocities,
+                                                   bool *valid) const
+    {
+        const int64_t ticks = dt.Ticks();
+
+        std::vector<double> tsince(near_index_.size());
+        for (size_t i = 0; i < tsince.size(); i++)
+        {
+            tsince[i] = static_cast<double>(ticks - near_epoch_[i]) / TicksPerMinute;
+        }
+        FindNearSpacePositions(tsince, positions, velocities, valid);
+
+        for (size_t i = 0; i < deep_.size(); i++)
+        {
+            const size_t out = deep_index_[i];
+            SGP4::IntegratorParams state;
+            const SGP4::Status status =
+                deep_[i].FindPosition<true, false>((dt - deep_[i].elements_.Epoch()).TotalMinutes(),
+                                                   state, positions[out], velocities[out]);
+
+            if (valid)
+            {
+                valid[out] = status == SGP4::OK;
+            }
+        }
+
+        FindInvalidPositions(positions, velocities, valid);
+    }
+
+    void SatelliteCatalogPropagator::FindPositions(const double *tsince,
+                                                   Vector *positions,
+                                                   Vector *velocities,
+                                                   bool *valid) const
+    {
+        std::vector<double> near_tsince(near_index_.size());
+        for (size_t i = 0; i < near_tsince.size(); i++)
+        {
+            near_tsince[i] = tsince[near_index_[i]];
+        }
+        FindNearSpacePositions(near_tsince, positions, velocities, valid);
+
+        for (size_t i = 0; i < deep_.size(); i++)
+        {
+            const size_t out = deep_index_[i];
+            SGP4::IntegratorParams state;
+            const SGP4::Status status =
+                deep_[i].FindPosition<true, false>(tsince[out], state, positions[out], velocities[out]);
+
+            if (valid)
+            {
+                valid[out] = status == SGP4::OK;
+            }
+        }
+
+        FindInvalidPositions(positions, velocities, valid);
+    }
+
+    void SatelliteCatalogPropagator::FindPositions(const DateTime *times,
+                                                   size_t count,
+                                                   ThreadPool &pool,
+                                                   Vector *positions,
+                                                   Vector *velocities,
+                                                   bool *valid) const
+    {
+        /*
+         * deep-space tasks first, so the slowest work starts earliest and
+         * the cheap near-space tasks fill in around it
+         */
+        std::vector<GridTask> tasks;
+        for (size_t i = 0; i < deep_.size(); i++)
+        {
+            for (size_t t = 0; t < count; t += kDeepSpaceTaskTimes)
+            {
+                GridTask task = {true, i, i + 1, t, std::min(t + kDeepSpaceTaskTimes, count)};
+                tasks.push_back(task);
+            }
+        }
+        for (size_t i = 0; i < near_index_.size(); i += kNearSpaceTaskObjects)
+        {
+            for (size_t t = 0; t < count; t += kNearSpaceTaskTimes)
+            {
+                GridTask task = {false,
+                                 i,
+                                 std::min(i + kNearSpaceTaskObjects, near_index_.size()),
+                                 t,
+                                 std::min(t + kNearSpaceTaskTimes, count)};
+                tasks.push_back(task);
+            }
+        }
+
+        /*
+         * each task writes its own elements only
+         */
+        std::vector<unsigned char> status(near_index_.empty() ? 0 : size_ * count);
+
+        pool.ParallelFor(tasks.size(), [&](size_t k)
+        {
+            const GridTask &task = tasks[k];
+            if (task.deep)
+            {
+                PropagateDeepSpaceTask(times, count, task.first,
+                                       task.time_first, task.time_last,
+                                       positions, velocities, valid);
+            }
+            else
+            {
+                PropagateNearSpaceTask(times, count, task.first, task.last,
+                                       task.time_first, task.time_last,
+                                       positions, velocities, status.data(), valid);
+            }
+        });
+
+        for (size_t i = 0; i < invalid_index_.size(); i++)
+        {
+            for (size_t t = 0; t < count; t++)
+            {
+                const size_t out = invalid_index_[i] * count + t;
+                positions[out] = Vector();
+                velocities[out] = Vector();
+
+                if (valid)
+                {
+                    valid[out] = false;
+                }
+            }
+        }
+    }
+
+    void SatelliteCatalogPropagator::PropagateNearSpaceTask(const DateTime *times,
+                                                            size_t count,
+                                                            size_t first,
+                                                            size_t last,
+                                                            size_t time_first,
+                                                            size_t time_last,
+                                                            Vector *positions,
+                                                            Vector *velocities,
+                                                            unsigned char *status,
+                                                            bool *valid) const
+    {
+        const size_t n = last - first;
+        std::vector<double> tsince(n);
+        std::vector<size_t> index(n);
+
+        for (size_t t = time_first; t < time_last; t++)
+        {
+            const int64_t ticks = times[t].Ticks();
+            for (size_t i = 0; i < n; i++)
+            {
+                tsince[i] = static_cast<double>(ticks - near_epoch_[first + i]) / TicksPerMinute;
+                index[i] = near_index_[first + i] * count + t;
+            }
+
+            /*
+             * the columns of objects [first, last) keep the full stride
+             */
+            if (single_precision_)
+            {
+                NearSpaceKernel::PropagateFloat(isa_,
+                                                near_consts_.data() + first,
+                                                near_index_.size(),
+                                                tsince.data(),
+                                                n,
+                                                index.data(),
+                                                positions,
+                                                velocities,
+                                                status);
+            }
+            else
+            {
+                NearSpaceKernel::Propagate(isa_,
+                                           near_consts_.data() + first,
+                                           near_index_.size(),
+                                           tsince.data(),
+                                           n,
+                                           index.data(),
+                                           positions,
+                                           velocities,
+                                           status);
+            }
+
+            if (valid)
+            {
+                for (size_t i = 0; i < n; i++)
+                {
+                    valid[index[i]] = status[index[i]] == SGP4::OK;
+                }
+            }
+        }
+    }
+
+    void SatelliteCatalogPropagator::PropagateDeepSpaceTask(const DateTime *times,
+                                                            size_t count,
+                                                            size_t object,
+                                                            size_t time_first,
+                                                            size_t time_last,
+                                                            Vector *positions,
+                                                            Vector *velocities,
+                                                            bool *valid) const
+    {
+        /*
+         * carry the resonance integrator from one time to the next
+         */
+        SGP4::IntegratorParams state;
+
+        for (size_t t = time_first; t < time_last; t++)
+        {
+            const size_t out = deep_index_[object] * count + t;
+            const SGP4::Status status =
+                deep_[object].FindPosition<true, false>((times[t] - deep_[object].elements_.Epoch()).TotalMinutes(),
+                                                        state, positions[out], velocities[out]);
+
+            if (valid)
+            {
+                valid[out] = status == SGP4::OK;
+            }
+        }
+    }
+
+    void SatelliteCatalogPropagator::FindNearSpacePositions(const std::vector<double> &tsince,
+                                                            Vector *positions,
+                                                            Vector *velocities,
+                                                            bool *valid) const
+    {
+        std::vector<unsigned char> status(size_);
+
+        if (single_precision_)
+        {
+            NearSpaceKernel::PropagateFloat(isa_,
+                                            near_consts_.data(),
+                                            near_index_.size(),
+                                            tsince.data(),
+                                            near_index_.size(),
+                                            near_index_.data(),
+                                            positions,
+                                            velocities,
+                                            status.data());
+        }
+        else
+        {
+            NearSpaceKernel::Propagate(isa_,
+                                       near_consts_.data(),
+                                       near_index_.size(),
+                                       tsince.data(),
+                                       near_index_.size(),
+                                       near_index_.data(),
+                                       positions,
+                                       velocities,
+                                       status.data());
+        }
+
+        if (valid)
+        {
+            for (size_t i = 0; i < near_index_.size(); i++)
+            {
+                const size_t out = near_index_[i];
+                valid[out] = status[out] == SGP4::OK;
+            }
+        }
+    }
+
+    void SatelliteCatalogPropagator::FindInvalidPositions(Vector *positions,
+                                                          Vector *velocities,
+                                                          bool *valid) const
+    {
+        for (size_t i = 0; i < invalid_index_.size(); i++)
+        {
+            const size_t out = invalid_index_[i];
+            positions[out] = Vector();
+            velocities[out] = Vector();
+
+            if (valid)
+            {
+                valid[out] = false;
+            }
+        }
+    }
+};
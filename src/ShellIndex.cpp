@@ -0,0 +1,213 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ShellIndex.hpp"
+
+#include "Globals.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    struct PerigeeBefore
+    {
+        explicit PerigeeBefore(const std::vector<double> &perigees)
+            : perigees_(perigees)
+        {
+        }
+
+        bool operator()(size_t a, size_t b) const
+        {
+            return perigees_[a] < perigees_[b] || (perigees_[a] == perigees_[b] && a < b);
+        }
+
+        const std::vector<double> &perigees_;
+    };
+}
+
+namespace LSGP4
+{
+    ShellIndex::ShellIndex(const std::vector<SGP4> &satellites)
+    {
+        perigees_.reserve(satellites.size());
+        apogees_.reserve(satellites.size());
+        for (size_t i = 0; i < satellites.size(); i++)
+        {
+            const OrbitalElements &elements = satellites[i].GetOrbitalElements();
+            perigees_.push_back(PerigeeRadius(elements));
+            apogees_.push_back(ApogeeRadius(elements));
+        }
+        Build();
+    }
+
+    ShellIndex::ShellIndex(const TleCatalog &catalog)
+    {
+        perigees_.reserve(catalog.Size());
+        apogees_.reserve(catalog.Size());
+        for (size_t i = 0; i < catalog.Size(); i++)
+        {
+            const OrbitalElements elements(catalog.Record(i));
+            perigees_.push_back(PerigeeRadius(elements));
+            apogees_.push_back(ApogeeRadius(elements));
+        }
+        Build();
+    }
+
+    double ShellIndex::PerigeeRadius(const OrbitalElements &elements)
+    {
+        return elements.RecoveredSemiMajorAxis() * (1.0 - elements.Eccentricity()) * kXKMPER;
+    }
+
+    double ShellIndex::ApogeeRadius(const OrbitalElements &elements)
+    {
+        return elements.RecoveredSemiMajorAxis() * (1.0 + elements.Eccentricity()) * kXKMPER;
+    }
+
+    void ShellIndex::Build()
+    {
+        const size_t n = perigees_.size();
+
+        order_.resize(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            order_[i] = i;
+        }
+        std::sort(order_.begin(), order_.end(), PerigeeBefore(perigees_));
+
+        sorted_perigees_.resize(n);
+        sorted_apogees_.resize(n);
+        for (size_t k = 0; k < n; k++)
+        {
+            sorted_perigees_[k] = perigees_[order_[k]];
+            sorted_apogees_[k] = apogees_[order_[k]];
+        }
+
+        max_apogees_.resize(n);
+        min_apogees_.resize(n);
+        if (n > 0)
+        {
+            BuildNode(0, n);
+        }
+    }
+
+    void ShellIndex::BuildNode(size_t first, size_t last)
+    {
+        const size_t middle = first + (last - first) / 2;
+        max_apogees_[middle] = sorted_apogees_[middle];
+        min_apogees_[middle] = sorted_apogees_[middle];
+
+        if (first < middle)
+        {
+            const size_t left = first + (middle - first) / 2;
+            BuildNode(first, middle);
+            max_apogees_[middle] = std::max(max_apogees_[middle], max_apogees_[left]);
+            min_apogees_[middle] = std::min(min_apogees_[middle], min_apogees_[left]);
+        }
+        if (middle + 1 < last)
+        {
+            const size_t right = middle + 1 + (last - middle - 1) / 2;
+            BuildNode(middle + 1, last);
+            max_apogees_[middle] = std::max(max_apogees_[middle], max_apogees_[right]);
+            min_apogees_[middle] = std::min(min_apogees_[middle], min_apogees_[right]);
+        }
+    }
+
+    void ShellIndex::Find(size_t first,
+                          size_t last,
+                          double low,
+                          double high,
+                          std::vector<size_t> *objects,
+                          bool &found) const
+    {
+        if (first >= last)
+        {
+            return;
+        }
+
+        /*
+         * nothing in the range reaches up to the band
+         */
+        const size_t middle = first + (last - first) / 2;
+        if (max_apogees_[middle] < low)
+        {
+            return;
+        }
+
+        /*
+         * everything in the range overlaps the band
+         */
+        if (min_apogees_[middle] >= low && sorted_perigees_[last - 1] <= high)
+        {
+            found = true;
+            if (objects != NULL)
+            {
+                objects->insert(objects->end(), order_.begin() + first, order_.begin() + last);
+            }
+            return;
+        }
+
+        Find(first, middle, low, high, objects, found);
+        if (found && objects == NULL)
+        {
+            return;
+        }
+
+        /*
+         * everything from the middle on starts above the band
+         */
+        if (sorted_perigees_[middle] > high)
+        {
+            return;
+        }
+
+        if (sorted_apogees_[middle] >= low)
+        {
+            found = true;
+            if (objects == NULL)
+            {
+                return;
+            }
+            objects->push_back(order_[middle]);
+        }
+
+        Find(middle + 1, last, low, high, objects, found);
+    }
+
+    void ShellIndex::FindOverlapping(double low, double high, std::vector<size_t> &objects) const
+    {
+        bool found = false;
+        Find(0, order_.size(), low, high, &objects, found);
+    }
+
+    void ShellIndex::FindNear(const OrbitalElements &elements,
+                              double distance,
+                              std::vector<size_t> &objects) const
+    {
+        FindOverlapping(PerigeeRadius(elements) - distance, ApogeeRadius(elements) + distance, objects);
+    }
+
+    void ShellIndex::FindInBand(double low, double high, std::vector<size_t> &objects) const
+    {
+        FindOverlapping(low + kXKMPER, high + kXKMPER, objects);
+    }
+
+    bool ShellIndex::Overlaps(double low, double high) const
+    {
+        bool found = false;
+        Find(0, order_.size(), low, high, NULL, found);
+        return found;
+    }
+};
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.hpp"
+
+namespace LSGP4
+{
+    ThreadPool::ThreadPool(size_t threads)
+        : workers_(threads > 0 ? threads : (std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1)),
+          task_(NULL),
+          generation_(0),
+          remaining_(0),
+          busy_(0),
+          stop_(false)
+    {
+        for (size_t i = 0; i < workers_.size(); i++)
+        {
+            workers_[i].begin = 0;
+            workers_[i].end = 0;
+        }
+
+        /*
+         * worker 0 is the thread calling ParallelFor()
+         */
+        for (size_t i = 1; i < workers_.size(); i++)
+        {
+            threads_.push_back(std::thread(&ThreadPool::ThreadMain, this, i));
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+
+        for (size_t i = 0; i < threads_.size(); i++)
+        {
+            threads_[i].join();
+        }
+    }
+
+    void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)> &task)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const size_t n = workers_.size();
+        for (size_t i = 0; i < n; i++)
+        {
+            std::lock_guard<std::mutex> lock(workers_[i].mutex);
+            workers_[i].begin = count * i / n;
+            workers_[i].end = count * (i + 1) / n;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            remaining_ = count;
+            /*
+             * the calling thread counts as busy until it runs out of tasks
+             */
+            busy_ = n;
+            error_ = std::exception_ptr();
+            generation_++;
+        }
+        start_.notify_all();
+
+        RunTasks(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        busy_--;
+        /*
+         * wait for idle workers as well as for the tasks, so none is still
+         * looking at the ranges when the next call resets them
+         */
+        while (remaining_ > 0 || busy_ > 0)
+        {
+            done_.wait(lock);
+        }
+        task_ = NULL;
+
+        if (error_)
+        {
+            std::exception_ptr error = error_;
+            error_ = std::exception_ptr();
+            std::rethrow_exception(error);
+        }
+    }
+
+    void ThreadPool::ThreadMain(size_t id)
+    {
+        size_t generation = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                while (!stop_ && generation == generation_)
+                {
+                    start_.wait(lock);
+                }
+                if (stop_)
+                {
+                    return;
+                }
+                generation = generation_;
+            }
+
+            RunTasks(id);
+
+            bool last;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                busy_--;
+                last = busy_ == 0;
+            }
+            if (last)
+            {
+                done_.notify_all();
+            }
+        }
+    }
+
+    void ThreadPool::RunTasks(size_t id)
+    {
+        size_t index;
+
+        while (TakeTask(id, index) || (StealTasks(id) && TakeTask(id, index)))
+        {
+            std::exception_ptr error;
+            try
+            {
+                (*task_)(index);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            bool finished;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (error && !error_)
+                {
+                    error_ = error;
+                }
+                remaining_--;
+                finished = remaining_ == 0;
+            }
+            if (finished)
+            {
+                done_.notify_all();
+            }
+        }
+    }
+
+    bool ThreadPool::TakeTask(size_t id, size_t &index)
+    {
+        Worker &worker = workers_[id];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+
+        if (worker.begin == worker.end)
+        {
+            return false;
+        }
+        index = worker.begin++;
+        return true;
+    }
+
+    bool ThreadPool::StealTasks(size_t id)
+    {
+        const size_t n = workers_.size();
+
+        while (true)
+        {
+            /*
+             * pick the worker with the most tasks left
+             */
+            size_t victim = id;
+            size_t most = 0;
+            for (size_t i = 1; i < n; i++)
+            {
+                const size_t k = (id + i) % n;
+                std::lock_guard<std::mutex> lock(workers_[k].mutex);
+                if (workers_[k].end - workers_[k].begin > most)
+                {
+                    most = workers_[k].end - workers_[k].begin;
+                    victim = k;
+                }
+            }
+
+            if (most == 0)
+            {
+                return false;
+            }
+
+            /*
+             * take the back half, rounded up so a single task moves too.
+             * the victim may have drained meanwhile, then look again
+             */
+            size_t begin;
+            size_t end;
+            {
+                std::lock_guard<std::mutex> lock(workers_[victim].mutex);
+                Worker &other = workers_[victim];
+                if (other.begin == other.end)
+                {
+                    continue;
+                }
+                end = other.end;
+                begin = other.end - (other.end - other.begin + 1) / 2;
+                other.end = begin;
+            }
+
+            std::lock_guard<std::mutex> lock(workers_[id].mutex);
+            workers_[id].begin = begin;
+            workers_[id].end = end;
+            return true;
+        }
+    }
+};
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TimeGrid.hpp"
+
+#include "CoordinateKernel.hpp"
+#include "Util.hpp"
+
+namespace LSGP4
+{
+    TimeGrid::TimeGrid(const DateTime &start, const TimeSpan &step, size_t count)
+    {
+        times_.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            times_.push_back(start.AddTicks(static_cast<int64_t>(i) * step.Ticks()));
+        }
+        Initialise();
+    }
+
+    TimeGrid::TimeGrid(const std::vector<DateTime> &times)
+        : times_(times)
+    {
+        Initialise();
+    }
+
+    void TimeGrid::Initialise()
+    {
+        gmst_.resize(times_.size());
+        for (size_t i = 0; i < times_.size(); i++)
+        {
+            gmst_[i] = times_[i].ToGreenwichSiderealTime();
+        }
+    }
+
+    size_t TimeGrid::AddObserver(const CoordGeodetic &geo)
+    {
+        observers_.push_back(geo);
+
+        CoordinateKernel::Station station;
+        CoordinateKernel::SetLocation(geo, station);
+
+        for (size_t i = 0; i < times_.size(); i++)
+        {
+            /*
+             * local mean sidereal time for the observers longitude
+             */
+            CoordinateKernel::SetSiderealTime(Util::WrapTwoPI(gmst_[i] + geo.longitude), station);
+            stations_.push_back(station);
+        }
+
+        return observers_.size() - 1;
+    }
+
+    CoordTopocentric TimeGrid::GetLookAngle(size_t observer, size_t i, const Eci &eci) const
+    {
+        return CoordinateKernel::GetLookAngle(stations_[observer * times_.size() + i],
+                                              eci.Position(),
+                                              eci.Velocity());
+    }
+
+    void TimeGrid::GetLookAngles(size_t observer,
+                                 size_t i,
+                                 const Eci *eci,
+                                 size_t n,
+                                 CoordTopocentric *look_angles) const
+    {
+        const CoordinateKernel::Station &station = stations_[observer * times_.size() + i];
+
+        for (size_t k = 0; k < n; k++)
+        {
+            look_angles[k] = CoordinateKernel::GetLookAngle(station, eci[k].Position(), eci[k].Velocity());
+        }
+    }
+
+    void TimeGrid::GetLookAngles(size_t observer,
+                                 size_t i,
+                                 const double *x,
+                                 const double *y,
+                                 const double *z,
+                                 const double *vx,
+                                 const double *vy,
+                                 const double *vz,
+                                 size_t n,
+                                 double *azimuth,
+                                 double *elevation,
+                                 double *range,
+                                 double *range_rate) const
+    {
+        CoordinateKernel::GetLookAngles(NearSpaceKernel::BestIsa(),
+                                        stations_[observer * times_.size() + i],
+                                        x, y, z, vx, vy, vz, n,
+                                        azimuth, elevation, range, range_rate);
+    }
+
+    void TimeGrid::ToGeodetic(size_t i, const Eci *eci, size_t n, CoordGeodetic *geodetic) const
+    {
+        static const size_t kBlock = 256;
+        const NearSpaceKernel::Isa isa = NearSpaceKernel::BestIsa();
+
+        double x[kBlock];
+        double y[kBlock];
+        double z[kBlock];
+        double lat[kBlock];
+        double lon[kBlock];
+        double alt[kBlock];
+
+        for (size_t first = 0; first < n; first += kBlock)
+        {
+            const size_t count = n - first < kBlock ? n - first : kBlock;
+            for (size_t k = 0; k < count; k++)
+            {
+                const Vector position = eci[first + k].Position();
+                x[k] = position.x;
+                y[k] = position.y;
+                z[k] = position.z;
+            }
+
+            CoordinateKernel::ToGeodetic(isa, gmst_[i], x, y, z, count, lat, lon, alt);
+
+            for (size_t k = 0; k < count; k++)
+            {
+                geodetic[first + k] = CoordGeodetic(lat[k], lon[k], alt[k], true);
+            }
+        }
+    }
+};
@@ -15,6 +15,8 @@
  */
 
 #include "Tle.hpp"
+#include "TleParser.hpp"
+#include "TleReader.hpp"
 
 #include <stdlib.h>
 #include <meb_print.h>
@@ -28,43 +30,6 @@ namespace LSGP4
     {
         static const unsigned int TLE1_COL_NORADNUM = 2;
         static const unsigned int TLE1_LEN_NORADNUM = 5;
-        static const unsigned int TLE1_COL_INTLDESC_A = 9;
-        static const unsigned int TLE1_LEN_INTLDESC_A = 2;
-        //  static const unsigned int TLE1_COL_INTLDESC_B = 11;
-        static const unsigned int TLE1_LEN_INTLDESC_B = 3;
-        //  static const unsigned int TLE1_COL_INTLDESC_C = 14;
-        static const unsigned int TLE1_LEN_INTLDESC_C = 3;
-        static const unsigned int TLE1_COL_EPOCH_A = 18;
-        static const unsigned int TLE1_LEN_EPOCH_A = 2;
-        static const unsigned int TLE1_COL_EPOCH_B = 20;
-        static const unsigned int TLE1_LEN_EPOCH_B = 12;
-        static const unsigned int TLE1_COL_MEANMOTIONDT2 = 33;
-        static const unsigned int TLE1_LEN_MEANMOTIONDT2 = 10;
-        static const unsigned int TLE1_COL_MEANMOTIONDDT6 = 44;
-        static const unsigned int TLE1_LEN_MEANMOTIONDDT6 = 8;
-        static const unsigned int TLE1_COL_BSTAR = 53;
-        static const unsigned int TLE1_LEN_BSTAR = 8;
-        //  static const unsigned int TLE1_COL_EPHEMTYPE = 62;
-        //  static const unsigned int TLE1_LEN_EPHEMTYPE = 1;
-        //  static const unsigned int TLE1_COL_ELNUM = 64;
-        //  static const unsigned int TLE1_LEN_ELNUM = 4;
-
-        static const unsigned int TLE2_COL_NORADNUM = 2;
-        static const unsigned int TLE2_LEN_NORADNUM = 5;
-        static const unsigned int TLE2_COL_INCLINATION = 8;
-        static const unsigned int TLE2_LEN_INCLINATION = 8;
-        static const unsigned int TLE2_COL_RAASCENDNODE = 17;
-        static const unsigned int TLE2_LEN_RAASCENDNODE = 8;
-        static const unsigned int TLE2_COL_ECCENTRICITY = 26;
-        static const unsigned int TLE2_LEN_ECCENTRICITY = 7;
-        static const unsigned int TLE2_COL_ARGPERIGEE = 34;
-        static const unsigned int TLE2_LEN_ARGPERIGEE = 8;
-        static const unsigned int TLE2_COL_MEANANOMALY = 43;
-        static const unsigned int TLE2_LEN_MEANANOMALY = 8;
-        static const unsigned int TLE2_COL_MEANMOTION = 52;
-        static const unsigned int TLE2_LEN_MEANMOTION = 11;
-        static const unsigned int TLE2_COL_REVATEPOCH = 63;
-        static const unsigned int TLE2_LEN_REVATEPOCH = 5;
     }
 
     /**
@@ -73,319 +38,67 @@ namespace LSGP4
  */
     void Tle::Initialize()
     {
-        if (!IsValidLineLength(line_one_))
-        {
-            throw TleException("Invalid length for line one");
-        }
-
-        if (!IsValidLineLength(line_two_))
-        {
-            throw TleException("Invalid length for line two");
-        }
-
-        if (line_one_[0] != '1')
-        {
-            throw TleException("Invalid line beginning for line one");
-        }
-
-        if (line_two_[0] != '2')
-        {
-            throw TleException("Invalid line beginning for line two");
-        }
-
-        unsigned int sat_number_1;
-        unsigned int sat_number_2;
-
-        ExtractInteger(line_one_.substr(TLE1_COL_NORADNUM,
-                                        TLE1_LEN_NORADNUM),
-                       sat_number_1);
-        ExtractInteger(line_two_.substr(TLE2_COL_NORADNUM,
-                                        TLE2_LEN_NORADNUM),
-                       sat_number_2);
-
-        if (sat_number_1 != sat_number_2)
-        {
-            throw TleException("Satellite numbers do not match");
-        }
-
-        norad_number_ = sat_number_1;
+        TleRecord record;
+        TleParser::Parse(line_one_.data(), line_one_.length(),
+                         line_two_.data(), line_two_.length(),
+                         record);
 
         if (name_.empty())
         {
             name_ = line_one_.substr(TLE1_COL_NORADNUM, TLE1_LEN_NORADNUM);
         }
 
-        int_designator_ = line_one_.substr(TLE1_COL_INTLDESC_A,
-                                           TLE1_LEN_INTLDESC_A + TLE1_LEN_INTLDESC_B + TLE1_LEN_INTLDESC_C);
-
-        unsigned int year = 0;
-        double day = 0.0;
-
-        ExtractInteger(line_one_.substr(TLE1_COL_EPOCH_A,
-                                        TLE1_LEN_EPOCH_A),
-                       year);
-        ExtractDouble(line_one_.substr(TLE1_COL_EPOCH_B,
-                                       TLE1_LEN_EPOCH_B),
-                      4, day);
-        ExtractDouble(line_one_.substr(TLE1_COL_MEANMOTIONDT2,
-                                       TLE1_LEN_MEANMOTIONDT2),
-                      2, mean_motion_dt2_);
-        ExtractExponential(line_one_.substr(TLE1_COL_MEANMOTIONDDT6,
-                                            TLE1_LEN_MEANMOTIONDDT6),
-                           mean_motion_ddt6_);
-        ExtractExponential(line_one_.substr(TLE1_COL_BSTAR,
-                                            TLE1_LEN_BSTAR),
-                           bstar_);
-
-        /*
-     * line 2
-     */
-        ExtractDouble(line_two_.substr(TLE2_COL_INCLINATION,
-                                       TLE2_LEN_INCLINATION),
-                      4, inclination_);
-        ExtractDouble(line_two_.substr(TLE2_COL_RAASCENDNODE,
-                                       TLE2_LEN_RAASCENDNODE),
-                      4, right_ascending_node_);
-        ExtractDouble(line_two_.substr(TLE2_COL_ECCENTRICITY,
-                                       TLE2_LEN_ECCENTRICITY),
-                      -1, eccentricity_);
-        ExtractDouble(line_two_.substr(TLE2_COL_ARGPERIGEE,
-                                       TLE2_LEN_ARGPERIGEE),
-                      4, argument_perigee_);
-        ExtractDouble(line_two_.substr(TLE2_COL_MEANANOMALY,
-                                       TLE2_LEN_MEANANOMALY),
-                      4, mean_anomaly_);
-        ExtractDouble(line_two_.substr(TLE2_COL_MEANMOTION,
-                                       TLE2_LEN_MEANMOTION),
-                      3, mean_motion_);
-        ExtractInteger(line_two_.substr(TLE2_COL_REVATEPOCH,
-                                        TLE2_LEN_REVATEPOCH),
-                       orbit_number_);
-
-        if (year < 57)
-            year += 2000;
-        else
-            year += 1900;
-
-        epoch_ = DateTime(year, day);
-
-        initd = true;
+        Assign(record);
     }
 
-    /**
- * Check 
- * @param str The string to check
- * @returns Whether true of the string has a valid length
- */
-    bool Tle::IsValidLineLength(const std::string &str)
-    {
-        return str.length() == LineLength() ? true : false;
-    }
-
-    /**
- * Convert a string containing an integer
- * @param[in] str The string to convert
- * @param[out] val The result
- * @exception TleException on conversion error
- */
-    void Tle::ExtractInteger(const std::string &str, unsigned int &val)
+    Tle::Tle(const TleRecord &record)
     {
-        bool found_digit = false;
-        unsigned int temp = 0;
+        char number[16];
+        snprintf(number, sizeof(number), "%05u", record.norad_number);
+        name_ = number;
 
-        for (std::string::const_iterator i = str.begin(); i != str.end(); ++i)
-        {
-            if (isdigit(*i))
-            {
-                found_digit = true;
-                temp = (temp * 10) + static_cast<unsigned int>(*i - '0');
-            }
-            else if (found_digit)
-            {
-                throw TleException("Unexpected non digit");
-            }
-            else if (*i != ' ')
-            {
-                throw TleException("Invalid character");
-            }
-        }
-
-        if (!found_digit)
-        {
-            val = 0;
-        }
-        else
-        {
-            val = temp;
-        }
+        Assign(record);
     }
 
-    /**
- * Convert a string containing an double
- * @param[in] str The string to convert
- * @param[in] point_pos The position of the decimal point. (-1 if none)
- * @param[out] val The result
- * @exception TleException on conversion error
- */
-    void Tle::ExtractDouble(const std::string &str, int point_pos, double &val)
+    TleRecord Tle::Record() const
     {
-        std::string temp;
-        bool found_digit = false;
-
-        for (std::string::const_iterator i = str.begin(); i != str.end(); ++i)
-        {
-            /*
-         * integer part
-         */
-            if (point_pos >= 0 && i < str.begin() + point_pos - 1)
-            {
-                bool done = false;
-
-                if (i == str.begin())
-                {
-                    if (*i == '-' || *i == '+')
-                    {
-                        /*
-                     * first character could be signed
-                     */
-                        temp += *i;
-                        done = true;
-                    }
-                }
-
-                if (!done)
-                {
-                    if (isdigit(*i))
-                    {
-                        found_digit = true;
-                        temp += *i;
-                    }
-                    else if (found_digit)
-                    {
-                        throw TleException("Unexpected non digit");
-                    }
-                    else if (*i != ' ')
-                    {
-                        throw TleException("Invalid character");
-                    }
-                }
-            }
-            /*
-         * decimal point
-         */
-            else if (point_pos >= 0 && i == str.begin() + point_pos - 1)
-            {
-                if (temp.length() == 0)
-                {
-                    /*
-                 * integer part is blank, so add a '0'
-                 */
-                    temp += '0';
-                }
-
-                if (*i == '.')
-                {
-                    /*
-                 * decimal point found
-                 */
-                    temp += *i;
-                }
-                else
-                {
-                    throw TleException("Failed to find decimal point");
-                }
-            }
-            /*
-         * fraction part
-         */
-            else
-            {
-                if (i == str.begin() && point_pos == -1)
-                {
-                    /*
-                 * no decimal point expected, add 0. beginning
-                 */
-                    temp += '0';
-                    temp += '.';
-                }
-
-                /*
-             * should be a digit
-             */
-                if (isdigit(*i))
-                {
-                    temp += *i;
-                }
-                else
-                {
-                    throw TleException("Invalid digit");
-                }
-            }
-        }
-
-        if (!Util::FromString<double>(temp, val))
-        {
-            throw TleException("Failed to convert value to double");
-        }
+        if (!initd) throw TleException("TLE object not initialized");
+
+        TleRecord record;
+        memset(&record, 0, sizeof(record));
+        record.norad_number = norad_number_;
+        strncpy(record.int_designator, int_designator_.c_str(), sizeof(record.int_designator) - 1);
+        record.epoch = epoch_.Ticks();
+        record.mean_motion_dt2 = mean_motion_dt2_;
+        record.mean_motion_ddt6 = mean_motion_ddt6_;
+        record.bstar = bstar_;
+        record.inclination = inclination_;
+        record.right_ascending_node = right_ascending_node_;
+        record.eccentricity = eccentricity_;
+        record.argument_perigee = argument_perigee_;
+        record.mean_anomaly = mean_anomaly_;
+        record.mean_motion = mean_motion_;
+        record.orbit_number = orbit_number_;
+        return record;
     }
 
-    /**
- * Convert a string containing an exponential
- * @param[in] str The string to convert
- * @param[out] val The result
- * @exception TleException on conversion error
- */
-    void Tle::ExtractExponential(const std::string &str, double &val)
+    void Tle::Assign(const TleRecord &record)
     {
-        std::string temp;
+        norad_number_ = record.norad_number;
+        int_designator_ = record.int_designator;
+        epoch_ = DateTime(record.epoch);
+        mean_motion_dt2_ = record.mean_motion_dt2;
+        mean_motion_ddt6_ = record.mean_motion_ddt6;
+        bstar_ = record.bstar;
+        inclination_ = record.inclination;
+        right_ascending_node_ = record.right_ascending_node;
+        eccentricity_ = record.eccentricity;
+        argument_perigee_ = record.argument_perigee;
+        mean_anomaly_ = record.mean_anomaly;
+        mean_motion_ = record.mean_motion;
+        orbit_number_ = record.orbit_number;
 
-        for (std::string::const_iterator i = str.begin(); i != str.end(); ++i)
-        {
-            if (i == str.begin())
-            {
-                if (*i == '-' || *i == '+' || *i == ' ')
-                {
-                    if (*i == '-')
-                    {
-                        temp += *i;
-                    }
-                    temp += '0';
-                    temp += '.';
-                }
-                else
-                {
-                    throw TleException("Invalid sign");
-                }
-            }
-            else if (i == str.end() - 2)
-            {
-                if (*i == '-' || *i == '+')
-                {
-                    temp += 'e';
-                    temp += *i;
-                }
-                else
-                {
-                    throw TleException("Invalid exponential sign");
-                }
-            }
-            else
-            {
-                if (isdigit(*i))
-                {
-                    temp += *i;
-                }
-                else
-                {
-                    throw TleException("Invalid digit");
-                }
-            }
-        }
-
-        if (!Util::FromString<double>(temp, val))
-        {
-            throw TleException("Failed to convert value to double");
-        }
+        initd = true;
     }
 
 #ifdef OS_Windows
@@ -561,59 +274,25 @@ namespace LSGP4
 
 std::vector<LSGP4::Tle> ReadTleFromFile(const char *fname)
 {
-    int m_obj = 1;
-    int n_obj = 0;
+    LSGP4::TleReader reader(fname);
 
-    FILE *fp = fopen(fname, "r");
-    if (fp == NULL)
-    {
-        printf("Error opening TLE file %s, exiting\n", fname);
-        throw std::invalid_argument("Could not access file");
-    }
+    std::vector<LSGP4::Tle> objs;
+    objs.reserve(reader.Count());
 
-    std::vector<LSGP4::Tle> objs(m_obj);
-    // start reading TLE file
-    char *res;
-    char l1[128];
-    char l2[128];
-    memset(l1, 0x0, sizeof(l1));
-    memset(l2, 0x0, sizeof(l2));
-    do
+    const size_t length = LSGP4::TleParser::LineLength();
+    LSGP4::TleRecord record;
+    while (reader.Next(record))
     {
-        char buf[128];
-        memset(buf, 0x0, sizeof(buf));
-        // 1. Read one line
-        res = fgets(buf, sizeof(buf), fp);
-        buf[strcspn(buf, "\n")] = '\0';
-        if (strlen(buf) != 69) // L1?
-            continue;
-        if (buf[0] != '1') // not L1
-        {
-            dbprintlf(FATAL "Expecting Line 1, %c, read %s", buf[0], buf);
-            continue;
-        }
-        if (m_obj <= n_obj)
+        const std::string line_one(reader.LineOne(), length);
+        const std::string line_two(reader.LineTwo(), length);
+        if (reader.NameLength() > 0)
         {
-            m_obj++;
-            objs.resize(m_obj);
+            objs.push_back(LSGP4::Tle(std::string(reader.Name(), reader.NameLength()), line_one, line_two));
         }
-        strncpy(l1, buf, 69); // L1 is found, read it in
-        l1[69] = '\0';
-        // 2. Read line 2
-        res = fgets(buf, sizeof(buf), fp);
-        buf[strcspn(buf, "\n")] = '\0';
-        if (strlen(buf) != 69) // L2?
-            continue;
-        if (buf[0] != '2') // not L2
+        else
         {
-            dbprintlf(FATAL "Expecting Line 2, read %s", buf);
-            continue;
+            objs.push_back(LSGP4::Tle(line_one, line_two));
         }
-        strncpy(l2, buf, 69); // L2 is found, read it in
-        l2[69] = '\0';
-        objs.at(n_obj).Update(l1, l2);
-        n_obj++;
-    } while (res != NULL);
-    fclose(fp);
+    }
     return objs;
-}
\ No newline at end of file
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TleCatalog.hpp"
+#include "TleReader.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    /*
+     * the size of a two line element set with its name, for reserving
+     */
+    const size_t kElementSetBytes = 142;
+
+    const size_t kMinChunkBytes = 1024 * 1024;
+}
+
+namespace LSGP4
+{
+    TleCatalog::TleCatalog(const char *fname)
+    {
+        TleReader reader(fname);
+
+        const size_t count = reader.Count();
+        records_.reserve(count);
+        name_offsets_.reserve(count + 1);
+        names_.reserve(count * 24);
+
+        TleRecord record;
+        while (reader.Next(record))
+        {
+            Add(record, reader.Name(), reader.NameLength());
+        }
+    }
+
+    TleCatalog::TleCatalog(const char *fname, ThreadPool &pool)
+    {
+        size_t size;
+        {
+            TleReader reader(fname);
+            size = reader.Size();
+        }
+
+        /*
+         * a few chunks per thread to even out the load, but no smaller than
+         * a megabyte
+         */
+        const size_t max_chunks = size / kMinChunkBytes + 1;
+        const size_t chunks = std::min(pool.Size() * 4, max_chunks);
+
+        std::vector<TleCatalog> parts(chunks);
+        pool.ParallelFor(chunks, [&](size_t i)
+                         {
+                             const size_t begin = size * i / chunks;
+                             const size_t end = size * (i + 1) / chunks;
+
+                             TleReader reader(fname);
+                             reader.Seek(begin);
+
+                             TleCatalog &part = parts[i];
+                             part.records_.reserve((end - begin) / kElementSetBytes + 1);
+                             part.names_.reserve((end - begin) / kElementSetBytes * 24);
+
+                             TleRecord record;
+                             while (reader.Next(record) && reader.Offset() < end)
+                             {
+                                 part.Add(record, reader.Name(), reader.NameLength());
+                             }
+                         });
+
+        /*
+         * join the chunks in order, each copied in parallel to its place
+         */
+        std::vector<size_t> first_record(chunks + 1, 0);
+        std::vector<size_t> first_name(chunks + 1, 0);
+        for (size_t i = 0; i < chunks; i++)
+        {
+            first_record[i + 1] = first_record[i] + parts[i].records_.size();
+            first_name[i + 1] = first_name[i] + parts[i].names_.size();
+        }
+
+        records_.resize(first_record[chunks]);
+        names_.resize(first_name[chunks]);
+        name_offsets_.resize(first_record[chunks] + 1, 0);
+
+        pool.ParallelFor(chunks, [&](size_t i)
+                         {
+                             const TleCatalog &part = parts[i];
+                             std::copy(part.records_.begin(), part.records_.end(),
+                                       records_.begin() + first_record[i]);
+                             std::copy(part.names_.begin(), part.names_.end(),
+                                       names_.begin() + first_name[i]);
+                             for (size_t j = 0; j < part.records_.size(); j++)
+                             {
+                                 name_offsets_[first_record[i] + j + 1] = first_name[i] + part.name_offsets_[j + 1];
+                             }
+                         });
+    }
+
+    std::string TleCatalog::Name(size_t i) const
+    {
+        const size_t begin = name_offsets_[i];
+        const size_t end = name_offsets_[i + 1];
+
+        if (begin == end)
+        {
+            char number[16];
+            snprintf(number, sizeof(number), "%05u", records_[i].norad_number);
+            return number;
+        }
+
+        return std::string(&names_[begin], end - begin);
+    }
+
+    void TleCatalog::Add(const TleRecord &record, const char *name, size_t name_length)
+    {
+        if (name_offsets_.empty())
+        {
+            name_offsets_.push_back(0);
+        }
+
+        records_.push_back(record);
+        names_.insert(names_.end(), name, name + name_length);
+        name_offsets_.push_back(names_.size());
+    }
+};
@@ -0,0 +1,306 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TleParser.hpp"
+
+#include "DateTime.hpp"
+
+#include <string.h>
+
+namespace
+{
+    const size_t TLE1_COL_NORADNUM = 2;
+    const size_t TLE1_LEN_NORADNUM = 5;
+    const size_t TLE1_COL_INTLDESC = 9;
+    const size_t TLE1_LEN_INTLDESC = 8;
+    const size_t TLE1_COL_EPOCH_A = 18;
+    const size_t TLE1_LEN_EPOCH_A = 2;
+    const size_t TLE1_COL_EPOCH_B = 20;
+    const size_t TLE1_LEN_EPOCH_B = 12;
+    const size_t TLE1_COL_MEANMOTIONDT2 = 33;
+    const size_t TLE1_LEN_MEANMOTIONDT2 = 10;
+    const size_t TLE1_COL_MEANMOTIONDDT6 = 44;
+    const size_t TLE1_LEN_MEANMOTIONDDT6 = 8;
+    const size_t TLE1_COL_BSTAR = 53;
+    const size_t TLE1_LEN_BSTAR = 8;
+
+    const size_t TLE2_COL_NORADNUM = 2;
+    const size_t TLE2_LEN_NORADNUM = 5;
+    const size_t TLE2_COL_INCLINATION = 8;
+    const size_t TLE2_LEN_INCLINATION = 8;
+    const size_t TLE2_COL_RAASCENDNODE = 17;
+    const size_t TLE2_LEN_RAASCENDNODE = 8;
+    const size_t TLE2_COL_ECCENTRICITY = 26;
+    const size_t TLE2_LEN_ECCENTRICITY = 7;
+    const size_t TLE2_COL_ARGPERIGEE = 34;
+    const size_t TLE2_LEN_ARGPERIGEE = 8;
+    const size_t TLE2_COL_MEANANOMALY = 43;
+    const size_t TLE2_LEN_MEANANOMALY = 8;
+    const size_t TLE2_COL_MEANMOTION = 52;
+    const size_t TLE2_LEN_MEANMOTION = 11;
+    const size_t TLE2_COL_REVATEPOCH = 63;
+    const size_t TLE2_LEN_REVATEPOCH = 5;
+
+    /*
+     * every power of ten a double holds exactly
+     */
+    const double kPowersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                   1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    inline bool IsDigit(const char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    /*
+     * an integer decimal digit string is exact in a double, as is each power
+     * of ten, so one correctly rounded multiply or divide gives the same
+     * double as converting the decimal text
+     */
+    inline double Scale(const int64_t mantissa, const int power)
+    {
+        const double m = static_cast<double>(mantissa);
+        return power < 0 ? m / kPowersOfTen[-power] : m * kPowersOfTen[power];
+    }
+
+    /*
+     * an unsigned integer, right aligned
+     */
+    void DecodeInteger(const char *str, size_t length, unsigned int &val)
+    {
+        bool found_digit = false;
+        unsigned int temp = 0;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            if (IsDigit(str[i]))
+            {
+                found_digit = true;
+                temp = (temp * 10) + static_cast<unsigned int>(str[i] - '0');
+            }
+            else if (found_digit)
+            {
+                throw TleException("Unexpected non digit");
+            }
+            else if (str[i] != ' ')
+            {
+                throw TleException("Invalid character");
+            }
+        }
+
+        val = found_digit ? temp : 0;
+    }
+
+    /*
+     * a decimal with the point at point_pos - 1, or with an implied leading
+     * decimal point when point_pos is -1
+     */
+    void DecodeDouble(const char *str, size_t length, int point_pos, double &val)
+    {
+        bool negative = false;
+        int64_t mantissa = 0;
+        size_t i = 0;
+
+        if (point_pos >= 0)
+        {
+            const size_t point = static_cast<size_t>(point_pos - 1);
+
+            /*
+             * integer part, first character could be signed. leading blanks
+             * are skipped, anything else before the digits is invalid and
+             * anything after them unexpected
+             */
+            if (point > 0 && (str[0] == '-' || str[0] == '+'))
+            {
+                negative = str[0] == '-';
+                i++;
+            }
+            bool found_digit = false;
+            for (; i < point; i++)
+            {
+                if (IsDigit(str[i]))
+                {
+                    found_digit = true;
+                    mantissa = mantissa * 10 + (str[i] - '0');
+                }
+                else if (found_digit)
+                {
+                    throw TleException("Unexpected non digit");
+                }
+                else if (str[i] != ' ')
+                {
+                    throw TleException("Invalid character");
+                }
+            }
+
+            if (str[point] != '.')
+            {
+                throw TleException("Failed to find decimal point");
+            }
+            i = point + 1;
+        }
+
+        /*
+         * fraction part
+         */
+        const size_t fraction_digits = length - i;
+        for (; i < length; i++)
+        {
+            if (!IsDigit(str[i]))
+            {
+                throw TleException("Invalid digit");
+            }
+            mantissa = mantissa * 10 + (str[i] - '0');
+        }
+
+        const double value = Scale(mantissa, -static_cast<int>(fraction_digits));
+        val = negative ? -value : value;
+    }
+
+    /*
+     * a signed fraction with an implied leading decimal point followed by a
+     * signed single digit exponent, as " 12345-4"
+     */
+    void DecodeExponential(const char *str, size_t length, double &val)
+    {
+        bool negative = false;
+        bool negative_exponent = false;
+        int64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            const char c = str[i];
+
+            if (i == 0)
+            {
+                if (c == '-' || c == '+' || c == ' ')
+                {
+                    negative = c == '-';
+                }
+                else
+                {
+                    throw TleException("Invalid sign");
+                }
+            }
+            else if (i == length - 2)
+            {
+                if (c == '-' || c == '+')
+                {
+                    negative_exponent = c == '-';
+                }
+                else
+                {
+                    throw TleException("Invalid exponential sign");
+                }
+            }
+            else
+            {
+                if (!IsDigit(c))
+                {
+                    throw TleException("Invalid digit");
+                }
+                if (i < length - 2)
+                {
+                    mantissa = mantissa * 10 + (c - '0');
+                    digits++;
+                }
+                else
+                {
+                    exponent = exponent * 10 + (c - '0');
+                }
+            }
+        }
+
+        const double value = Scale(mantissa, (negative_exponent ? -exponent : exponent) - digits);
+        val = negative ? -value : value;
+    }
+}
+
+namespace LSGP4
+{
+    void TleParser::Parse(const char *line_one,
+                          size_t length_one,
+                          const char *line_two,
+                          size_t length_two,
+                          TleRecord &record)
+    {
+        if (length_one != LineLength())
+        {
+            throw TleException("Invalid length for line one");
+        }
+
+        if (length_two != LineLength())
+        {
+            throw TleException("Invalid length for line two");
+        }
+
+        if (line_one[0] != '1')
+        {
+            throw TleException("Invalid line beginning for line one");
+        }
+
+        if (line_two[0] != '2')
+        {
+            throw TleException("Invalid line beginning for line two");
+        }
+
+        unsigned int sat_number_1;
+        unsigned int sat_number_2;
+
+        DecodeInteger(line_one + TLE1_COL_NORADNUM, TLE1_LEN_NORADNUM, sat_number_1);
+        DecodeInteger(line_two + TLE2_COL_NORADNUM, TLE2_LEN_NORADNUM, sat_number_2);
+
+        if (sat_number_1 != sat_number_2)
+        {
+            throw TleException("Satellite numbers do not match");
+        }
+
+        record.norad_number = sat_number_1;
+
+        memcpy(record.int_designator, line_one + TLE1_COL_INTLDESC, TLE1_LEN_INTLDESC);
+        record.int_designator[TLE1_LEN_INTLDESC] = '\0';
+
+        unsigned int year = 0;
+        double day = 0.0;
+
+        DecodeInteger(line_one + TLE1_COL_EPOCH_A, TLE1_LEN_EPOCH_A, year);
+        DecodeDouble(line_one + TLE1_COL_EPOCH_B, TLE1_LEN_EPOCH_B, 4, day);
+        DecodeDouble(line_one + TLE1_COL_MEANMOTIONDT2, TLE1_LEN_MEANMOTIONDT2, 2, record.mean_motion_dt2);
+        DecodeExponential(line_one + TLE1_COL_MEANMOTIONDDT6, TLE1_LEN_MEANMOTIONDDT6, record.mean_motion_ddt6);
+        DecodeExponential(line_one + TLE1_COL_BSTAR, TLE1_LEN_BSTAR, record.bstar);
+
+        /*
+         * line 2
+         */
+        DecodeDouble(line_two + TLE2_COL_INCLINATION, TLE2_LEN_INCLINATION, 4, record.inclination);
+        DecodeDouble(line_two + TLE2_COL_RAASCENDNODE, TLE2_LEN_RAASCENDNODE, 4, record.right_ascending_node);
+        DecodeDouble(line_two + TLE2_COL_ECCENTRICITY, TLE2_LEN_ECCENTRICITY, -1, record.eccentricity);
+        DecodeDouble(line_two + TLE2_COL_ARGPERIGEE, TLE2_LEN_ARGPERIGEE, 4, record.argument_perigee);
+        DecodeDouble(line_two + TLE2_COL_MEANANOMALY, TLE2_LEN_MEANANOMALY, 4, record.mean_anomaly);
+        DecodeDouble(line_two + TLE2_COL_MEANMOTION, TLE2_LEN_MEANMOTION, 3, record.mean_motion);
+        DecodeInteger(line_two + TLE2_COL_REVATEPOCH, TLE2_LEN_REVATEPOCH, record.orbit_number);
+
+        if (year < 57)
+            year += 2000;
+        else
+            year += 1900;
+
+        record.epoch = DateTime(year, day).Ticks();
+    }
+};
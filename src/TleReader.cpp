@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TleReader.hpp"
+
+#include <string.h>
+
+namespace
+{
+    /*
+     * pages read are released in blocks of this size
+     */
+    const size_t kReleaseBytes = 16 * 1024 * 1024;
+
+    /*
+     * find the line starting at position, without its line ending, and move
+     * position on to the next line
+     */
+    inline const char *NextLine(const char *data, size_t size, size_t &position, size_t &length)
+    {
+        const char *line = data + position;
+        const char *end = static_cast<const char *>(memchr(line, '\n', size - position));
+
+        if (end == NULL)
+        {
+            length = size - position;
+            position = size;
+        }
+        else
+        {
+            length = static_cast<size_t>(end - line);
+            position += length + 1;
+        }
+
+        if (length > 0 && line[length - 1] == '\r')
+        {
+            length--;
+        }
+
+        return line;
+    }
+}
+
+namespace LSGP4
+{
+    TleReader::TleReader(const char *fname)
+        : file_(fname), data_(file_.Data()), size_(file_.Size()),
+          position_(0), released_(0), skip_(0),
+          name_(NULL), name_length_(0), line_one_(NULL), line_two_(NULL)
+    {
+        file_.AdviseSequential();
+    }
+
+    bool TleReader::Next(TleRecord &record)
+    {
+        const size_t line_length = TleParser::LineLength();
+
+        const char *name = NULL;
+        size_t name_length = 0;
+        const char *line_one = NULL;
+
+        while (position_ < size_)
+        {
+            size_t length;
+            const char *line = NextLine(data_, size_, position_, length);
+
+            if (length == line_length && line[0] == '1')
+            {
+                if (line_one != NULL)
+                {
+                    /*
+                     * a line one straight after another has no name
+                     */
+                    name = NULL;
+                    name_length = 0;
+                }
+                line_one = line;
+            }
+            else if (length == line_length && line[0] == '2' && line_one != NULL)
+            {
+                if (static_cast<size_t>(line - data_) < skip_)
+                {
+                    name = NULL;
+                    name_length = 0;
+                    line_one = NULL;
+                    continue;
+                }
+
+                TleParser::Parse(line_one, line_length, line, line_length, record);
+
+                name_ = name;
+                name_length_ = name_length;
+                line_one_ = line_one;
+                line_two_ = line;
+
+                if (position_ - released_ >= kReleaseBytes)
+                {
+                    Release();
+                }
+                return true;
+            }
+            else if (length == line_length)
+            {
+                /*
+                 * a stray element line is not a name
+                 */
+                name = NULL;
+                name_length = 0;
+                line_one = NULL;
+            }
+            else
+            {
+                /*
+                 * a candidate name, without the "0 " of three line element
+                 * files or trailing blanks
+                 */
+                if (length >= 2 && line[0] == '0' && line[1] == ' ')
+                {
+                    line += 2;
+                    length -= 2;
+                }
+                while (length > 0 && (line[length - 1] == ' ' || line[length - 1] == '\t'))
+                {
+                    length--;
+                }
+                name = line;
+                name_length = length;
+                line_one = NULL;
+            }
+        }
+
+        name_ = NULL;
+        name_length_ = 0;
+        line_one_ = NULL;
+        line_two_ = NULL;
+        return false;
+    }
+
+    size_t TleReader::Count() const
+    {
+        size_t count = 0;
+        size_t position = 0;
+
+        while (position < size_)
+        {
+            size_t length;
+            const char *line = NextLine(data_, size_, position, length);
+            if (length == TleParser::LineLength() && line[0] == '2')
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    void TleReader::Seek(size_t offset)
+    {
+        Rewind();
+
+        if (offset >= size_)
+        {
+            position_ = size_;
+            return;
+        }
+
+        /*
+         * an element set is decided by its line two and the two lines before
+         * it, so start reading from the second line before the offset
+         */
+        size_t start = offset;
+        while (start > 0 && data_[start - 1] != '\n')
+        {
+            start--;
+        }
+        for (int lines = 0; lines < 2 && start > 0; lines++)
+        {
+            start--;
+            while (start > 0 && data_[start - 1] != '\n')
+            {
+                start--;
+            }
+        }
+
+        position_ = start;
+        released_ = start;
+        skip_ = offset;
+    }
+
+    void TleReader::Rewind()
+    {
+        position_ = 0;
+        released_ = 0;
+        skip_ = 0;
+        name_ = NULL;
+        name_length_ = 0;
+        line_one_ = NULL;
+        line_two_ = NULL;
+    }
+
+    void TleReader::Release()
+    {
+        /*
+         * keep the pages of the current element set
+         */
+        released_ = file_.Release(released_, static_cast<size_t>(line_one_ - data_));
+    }
+
+    size_t TleReader::ForEach(const char *fname,
+                              const std::function<void(const TleRecord &record,
+                                                       const char *name,
+                                                       size_t name_length)> &callback)
+    {
+        TleReader reader(fname);
+        TleRecord record;
+        size_t count = 0;
+
+        while (reader.Next(record))
+        {
+            callback(record, reader.Name(), reader.NameLength());
+            count++;
+        }
+
+        return count;
+    }
+};
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Tracker.hpp"
+
+#include "Globals.hpp"
+
+namespace LSGP4
+{
+    Tracker::Tracker(const SGP4 &sgp4, const CoordGeodetic &geo, const DateTime &start, const TimeSpan &step)
+        : sgp4_(sgp4), step_(step), start_(start), ticks_(0)
+    {
+        step_minutes_ = step.TotalMinutes();
+
+        /*
+         * as DateTime::ToGreenwichSiderealTime(), which advances at a fixed
+         * rate through the day
+         */
+        step_theta_ = kTWOPI * kOMEGA_E * step.TotalDays();
+
+        CoordinateKernel::SetLocation(geo, station_);
+
+        longitude_ = geo.longitude;
+        Reset(start);
+    }
+
+    void Tracker::Reset(const DateTime &start)
+    {
+        start_ = start;
+        ticks_ = 0;
+        start_tsince_ = (start - sgp4_.GetOrbitalElements().Epoch()).TotalMinutes();
+        start_theta_ = start.ToLocalMeanSiderealTime(longitude_);
+
+        /*
+         * nothing carries over from before
+         */
+        integ_params_ = SGP4::IntegratorParams();
+        seed_ = SGP4::KeplerSeed();
+
+        Update();
+    }
+
+    void Tracker::Tick()
+    {
+        ticks_++;
+        Update();
+    }
+
+    void Tracker::Update()
+    {
+        /*
+         * from the start rather than by accumulating steps, which would
+         * drift
+         */
+        const double tsince = start_tsince_ + static_cast<double>(ticks_) * step_minutes_;
+        SGP4::Status status;
+        if (sgp4_.use_deep_space_)
+        {
+            status = sgp4_.FindPositionSDP4(tsince, integ_params_, position_, velocity_, &seed_);
+        }
+        else if (sgp4_.use_simple_model_)
+        {
+            status = sgp4_.FindPositionSGP4<true>(tsince, position_, velocity_, &seed_);
+        }
+        else
+        {
+            status = sgp4_.FindPositionSGP4<false>(tsince, position_, velocity_, &seed_);
+        }
+
+        if (status != SGP4::OK)
+        {
+            sgp4_.ThrowStatus(status, tsince, position_, velocity_);
+        }
+
+        CoordinateKernel::SetSiderealTime(start_theta_ + static_cast<double>(ticks_) * step_theta_, station_);
+        look_angle_ = CoordinateKernel::GetLookAngle(station_, position_, velocity_);
+    }
+};
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 SmallSatMakers
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "VisibilityScheduler.hpp"
+
+#include "TimeGrid.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    using namespace LSGP4;
+
+    bool ContactBefore(const Contact &a, const Contact &b)
+    {
+        if (a.pass.aos != b.pass.aos)
+        {
+            return a.pass.aos < b.pass.aos;
+        }
+        if (a.satellite != b.satellite)
+        {
+            return a.satellite < b.satellite;
+        }
+        return a.station < b.station;
+    }
+}
+
+namespace LSGP4
+{
+    VisibilityScheduler::VisibilityScheduler(const std::vector<SGP4> &satellites,
+                                             const std::vector<Observer> &stations,
+                                             double min_elevation)
+        : satellites_(satellites),
+          stations_(stations),
+          min_elevation_(min_elevation),
+          tolerance_(0.01)
+    {
+    }
+
+    void VisibilityScheduler::SetTolerance(const TimeSpan &tolerance)
+    {
+        tolerance_ = tolerance.TotalSeconds();
+    }
+
+    std::vector<Contact> VisibilityScheduler::FindContacts(const DateTime &start,
+                                                           const DateTime &end) const
+    {
+        std::vector<Contact> contacts;
+        const double span = (end - start).TotalSeconds();
+        if (!(span > 0.0))
+        {
+            return contacts;
+        }
+
+        /*
+         * one set of sample times for every satellite, fine enough for the
+         * fastest
+         */
+        double step = 0.0;
+        for (size_t i = 0; i < satellites_.size(); i++)
+        {
+            const double satellite_step = PassPredictor::DefaultTimeStep(satellites_[i]);
+            step = i == 0 ? satellite_step : std::min(step, satellite_step);
+        }
+        const std::vector<double> times = PassPredictor::SampleTimes(step, span);
+
+        /*
+         * sidereal time and station positions once per sample time
+         */
+        std::vector<DateTime> sample_times(times.size());
+        for (size_t j = 0; j < times.size(); j++)
+        {
+            sample_times[j] = start.AddSeconds(times[j]);
+        }
+        TimeGrid grid(sample_times);
+        for (size_t k = 0; k < stations_.size(); k++)
+        {
+            grid.AddObserver(stations_[k].GetLocation());
+        }
+
+        std::vector<std::vector<double> > elevations(stations_.size(), std::vector<double>(times.size()));
+        std::vector<double> satellite_times;
+        std::vector<PassDetails> passes;
+
+        for (size_t i = 0; i < satellites_.size(); i++)
+        {
+            const SGP4 &sgp4 = satellites_[i];
+
+            for (size_t k = 0; k < stations_.size(); k++)
+            {
+                elevations[k].resize(times.size());
+            }
+
+            /*
+             * one propagation per sample time, shared by every station, up
+             * to the last sample the satellite propagates to
+             */
+            SGP4::IntegratorParams integ_params;
+            size_t valid = 0;
+            for (; valid < times.size(); valid++)
+            {
+                Vector position;
+                Vector velocity;
+                const double tsince = (grid.Time(valid) - sgp4.GetOrbitalElements().Epoch()).TotalMinutes();
+                if (sgp4.FindPosition(tsince, integ_params, position, velocity) != SGP4::OK)
+                {
+                    break;
+                }
+
+                const Eci eci(grid.Time(valid), position, velocity);
+                for (size_t k = 0; k < stations_.size(); k++)
+                {
+                    elevations[k][valid] = grid.GetLookAngle(k, valid, eci).elevation;
+                }
+            }
+
+            for (size_t k = 0; k < stations_.size(); k++)
+            {
+                elevations[k].resize(valid);
+            }
+            satellite_times.assign(times.begin(), times.begin() + valid);
+
+            for (size_t k = 0; k < stations_.size(); k++)
+            {
+                passes.clear();
+                PassPredictor::FindPasses(sgp4,
+                                          stations_[k],
+                                          min_elevation_,
+                                          tolerance_,
+                                          start,
+                                          satellite_times,
+                                          elevations[k],
+                                          passes);
+
+                for (size_t p = 0; p < passes.size(); p++)
+                {
+                    Contact contact = {i, k, passes[p]};
+                    contacts.push_back(contact);
+                }
+            }
+        }
+
+        std::sort(contacts.begin(), contacts.end(), ContactBefore);
+        return contacts;
+    }
+};